@@ -5,6 +5,7 @@ import { useConstructAttack } from '@hooks/useConstructAttack';
 import { PlayerConstructStats } from '@hooks/usePlayerConstructStats';
 import { useTokenMeta } from '@hooks/useTokenMeta';
 import { useTokenBalances } from '@hooks/useTokenBalances';
+import { useDamagePreview } from '@hooks/useDamagePreview';
 import { useAppSelector } from '@states/hooks';
 import { selectConnectedAccount } from '@states/appState';
 import { computeNarrationTags } from '@lib/narration/computeTags';
@@ -75,6 +76,14 @@ export const AttackForm: React.FC<AttackFormProps> = ({ construct, cooldownStatu
 
     const isInCooldown = cooldownStatus?.isInCooldown ?? false;
 
+    const damagePreview = useDamagePreview({
+        construct,
+        signaAmount,
+        tokens: tokenSelections,
+        tokenMetas,
+        debuffStacks: playerStats?.debuffStacks ?? 0,
+    });
+
     // Activation amount in SIGNA (added on top of user's attack amount)
     const activationSigna = useMemo(() => {
         return parseFloat(Amount.fromPlanck(construct.minActivation).getSigna());
@@ -383,6 +392,30 @@ export const AttackForm: React.FC<AttackFormProps> = ({ construct, cooldownStatu
                     />
                 )}
 
+                {/* Damage Preview - an attack in cooldown deals no damage (refund minus penalty) */}
+                {damagePreview && !isInCooldown && parseFloat(signaAmount) >= MIN_SIGNA_ATTACK && (
+                    <div
+                        className="mb-4 text-[0.65rem] text-[var(--text-dim)]"
+                        style={{ fontFamily: "'IBM Plex Mono', monospace" }}
+                    >
+                        Expected damage: <span className="text-[var(--gold)]">{damagePreview.effectiveDamage.toLocaleString()} HP</span>
+                        {damagePreview.isFinalBlow && <span className="text-[var(--ember)]"> — final blow</span>}
+                        {damagePreview.breachLimitHit && !damagePreview.isFinalBlow && (
+                            <span className="text-[var(--text-faint)]"> (capped by breach limit, {damagePreview.preBreachDamage.toLocaleString()} HP uncapped)</span>
+                        )}
+                        {damagePreview.isDebuffed && (
+                            <span className="text-[var(--text-faint)]"> (debuffed)</span>
+                        )}
+                        {damagePreview.ineffectiveTokenIds.length > 0 && (
+                            <div className="mt-1 text-[var(--text-faint)]">
+                                No effect: {damagePreview.ineffectiveTokenIds
+                                    .map(id => tokenMetas.find(t => t.tokenId === id)?.name ?? id)
+                                    .join(', ')}
+                            </div>
+                        )}
+                    </div>
+                )}
+
                 {/* Attack Button */}
                 <button
                     className="w-full py-3 border-none rounded-sm text-white text-[0.85rem] font-semibold uppercase tracking-[0.12em] cursor-pointer transition-all duration-200 max-md:py-2.5 max-md:text-[0.8rem] hover:enabled:brightness-110 hover:enabled:shadow-[0_4px_20px_rgba(232,93,58,0.3)] disabled:opacity-40 disabled:cursor-not-allowed"
@@ -1,5 +1,6 @@
 import { FC, createContext, PropsWithChildren } from "react";
 import {ExtensionWallet, MobileWallet} from '@signumjs/wallets';
+import {IPFS_GATEWAY} from '@lib/ipfsConfig';
 
 const toStringArray = (csv: any = ""): Array<string> => csv.length ? csv.split(",") :[];
 
@@ -14,7 +15,7 @@ export const Config = {
     Network: process.env.NEXT_PUBLIC_SIGNUM_NETWORK || "Signum-TESTNET",
   },
   Ipfs:{
-    Gateway: process.env.NEXT_PUBLIC_IPFS_GATEWAY || "https://ipfs.io/ipfs",
+    Gateway: IPFS_GATEWAY,
   }
 };
 
@@ -3,6 +3,7 @@ import {AttackRecord} from '@lib/construct/types';
 import {getSignaRankTokenId, POLLING_INTERVALS} from '@lib/construct/constants';
 import {resolveAccount} from '@lib/construct/accountCache';
 import {useSignumLedger} from './useSignumLedger';
+import {timeConstructHook} from '@lib/metrics';
 
 interface UseAttackHistoryResult {
     attacks: AttackRecord[];
@@ -18,7 +19,7 @@ export const useAttackHistory = (
 
     const {data: attacks = [], isLoading: loading, error: queryError} = useQuery({
         queryKey: ['attackHistory', contractId, xpTokenId],
-        queryFn: async () => {
+        queryFn: () => timeConstructHook('useAttackHistory', async () => {
             if (!ledger || !contractId || !xpTokenId) {
                 return [];
             }
@@ -54,7 +55,7 @@ export const useAttackHistory = (
             }
 
             return attackRecords;
-        },
+        }),
         enabled: !!ledger && !!contractId && !!xpTokenId,
         staleTime: 30 * 1000,
         refetchInterval: POLLING_INTERVALS.attackHistory,
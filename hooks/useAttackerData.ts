@@ -2,13 +2,14 @@ import {useQuery} from '@tanstack/react-query';
 import {useSignumLedger} from './useSignumLedger';
 import {getSignaRankTokenId} from "@lib/construct/constants";
 import {Address} from "@signumjs/core";
+import {timeConstructHook} from '@lib/metrics';
 
 export const useAttackerData = (accountId: string | null | undefined) => {
     const ledger = useSignumLedger();
 
     const {data} = useQuery({
         queryKey: ['accountName', accountId],
-        queryFn: async () => {
+        queryFn: () => timeConstructHook('useAttackerData', async () => {
             if (!ledger || !accountId) return null;
             try {
                 const account = await ledger.account.getAccount({accountId});
@@ -26,7 +27,7 @@ export const useAttackerData = (accountId: string | null | undefined) => {
                     attackerXp: 0
                 };
             }
-        },
+        }),
         enabled: !!ledger && !!accountId,
         staleTime: Infinity,
         gcTime: Infinity,
@@ -7,6 +7,7 @@ import {ReadOnlyPlayer} from "@signarank/client"
 import {Amount} from "@signumjs/util"
 import {getSeasonNameForContract} from '@lib/construct/seasonConstructs'
 import {resolveDamageVariantUrl, resolveDisplayUrl} from '@lib/construct/damageVariants'
+import {timeConstructHook} from '@lib/metrics'
 
 interface UseConstructResult {
     construct: ConstructData | null;
@@ -20,7 +21,7 @@ export const useConstruct = (contractId: string | null): UseConstructResult => {
 
     const {data: construct, isLoading: loading, error: queryError, refetch} = useQuery({
         queryKey: ['construct', contractId],
-        queryFn: async () => {
+        queryFn: () => timeConstructHook('useConstruct', async () => {
             if (!contractId) return null;
             if (!ledger) return null;
 
@@ -88,7 +89,7 @@ export const useConstruct = (contractId: string | null): UseConstructResult => {
             });
 
             return data;
-        },
+        }),
         enabled: !!contractId && !!ledger,
         staleTime: 20 * 1000,
         refetchInterval: POLLING_INTERVALS.currentHp,
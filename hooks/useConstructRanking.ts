@@ -2,6 +2,7 @@ import {useQuery} from '@tanstack/react-query';
 import {useSignumLedger} from './useSignumLedger';
 import {resolveAccount} from '@lib/construct/accountCache';
 import {POLLING_INTERVALS} from '@lib/construct/constants';
+import {timeConstructHook} from '@lib/metrics';
 
 export interface RankingEntry {
     rank: number;
@@ -21,7 +22,7 @@ export const useConstructRanking = (
 
     const {data: ranking = [], isLoading: loading} = useQuery({
         queryKey: ['constructRanking', hpTokenId],
-        queryFn: async (): Promise<RankingEntry[]> => {
+        queryFn: () => timeConstructHook('useConstructRanking', async (): Promise<RankingEntry[]> => {
             if (!ledger || !hpTokenId) return [];
 
             const result = await ledger.asset.getAssetHolders({
@@ -50,7 +51,7 @@ export const useConstructRanking = (
                     sharePercent: maxHp > 0 ? (damage / maxHp) * 100 : 0,
                 };
             });
-        },
+        }),
         enabled: !!ledger && !!hpTokenId,
         staleTime: 30 * 1000,
         refetchInterval: POLLING_INTERVALS.attackHistory,
@@ -0,0 +1,63 @@
+import {useMemo} from 'react';
+import {useQuery} from '@tanstack/react-query';
+import {Amount, ChainValue} from '@signumjs/util';
+import {ConstructData, TokenMeta} from '@lib/construct/types';
+import {loadDamageModifiers} from '@lib/construct/damageEngine';
+import {computeDamagePreview, DamagePreview} from '@lib/construct/damagePipeline';
+import {useSignumLedger} from './useSignumLedger';
+
+interface UseDamagePreviewArgs {
+    construct: ConstructData;
+    signaAmount: string;
+    tokens: { tokenId: string; quantity: string }[];
+    tokenMetas: TokenMeta[];
+    debuffStacks: number;
+}
+
+function toPlanck(signa: string): bigint | null {
+    try {
+        return BigInt(Amount.fromSigna(signa || '0').getPlanck());
+    } catch {
+        return null;
+    }
+}
+
+function toQuantity(quantity: string, decimals: number): bigint {
+    try {
+        return BigInt(ChainValue.create(decimals).setCompound(quantity || '0').getAtomic());
+    } catch {
+        return BigInt(0);
+    }
+}
+
+/**
+ * Previews the damage of the attack currently entered, as the contract would compute it.
+ */
+export const useDamagePreview = ({construct, signaAmount, tokens, tokenMetas, debuffStacks}: UseDamagePreviewArgs): DamagePreview | null => {
+    const ledger = useSignumLedger();
+
+    const {data: modifiers} = useQuery({
+        queryKey: ['damageModifiers', construct.contractId],
+        queryFn: () => loadDamageModifiers(ledger!, construct.contractId),
+        enabled: !!ledger,
+        staleTime: 10 * 60 * 1000,
+        refetchOnWindowFocus: false,
+    });
+
+    return useMemo(() => {
+        if (!modifiers) return null;
+        const amount = toPlanck(signaAmount);
+        if (amount === null) return null;
+
+        return computeDamagePreview({
+            amount,
+            tokens: tokens.map(t => ({
+                tokenId: t.tokenId,
+                quantity: toQuantity(t.quantity, tokenMetas.find(m => m.tokenId === t.tokenId)?.decimals ?? 0),
+            })),
+            construct,
+            debuffStacks,
+            modifiers,
+        });
+    }, [modifiers, signaAmount, tokens, tokenMetas, debuffStacks, construct]);
+};
@@ -1,6 +1,7 @@
 import { useQuery } from '@tanstack/react-query';
 import { Transaction } from '@signumjs/core';
 import { useSignumLedger } from './useSignumLedger';
+import { timeConstructHook } from '@lib/metrics';
 
 export type AttackStatus = 'pending' | 'processing';
 
@@ -24,7 +25,7 @@ export const usePendingAttacks = (contractId: string | null): UsePendingAttacksR
 
     const { data: pendingAttacks = [], isLoading: loading } = useQuery({
         queryKey: ['pendingAttacks', contractId],
-        queryFn: async () => {
+        queryFn: () => timeConstructHook('usePendingAttacks', async () => {
             if (!ledger || !contractId) return [];
 
             // Fetch unconfirmed (mempool) and recent confirmed transactions in parallel
@@ -77,7 +78,7 @@ export const usePendingAttacks = (contractId: string | null): UsePendingAttacksR
             }
 
             return results;
-        },
+        }),
         enabled: !!ledger && !!contractId,
         refetchInterval: 15 * 1000,
         staleTime: 10 * 1000,
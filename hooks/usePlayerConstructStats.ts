@@ -2,6 +2,7 @@ import {useQuery} from '@tanstack/react-query';
 import {ReadOnlyPlayer} from '@signarank/client';
 import {ContractMaps, POLLING_INTERVALS} from '@lib/construct/constants';
 import {useSignumLedger} from './useSignumLedger';
+import {timeConstructHook} from '@lib/metrics';
 
 export interface PlayerConstructStats {
     /** Number of HP tokens held by player — equals damage dealt to this construct */
@@ -49,7 +50,7 @@ export const usePlayerConstructStats = ({
             debuffDamageReduction,
             debuffMaxStack,
         ],
-        queryFn: async (): Promise<PlayerConstructStats | null> => {
+        queryFn: () => timeConstructHook('usePlayerConstructStats', async (): Promise<PlayerConstructStats | null> => {
             if (!ledger || !contractId || !userAccountId) return null;
 
             const [account, playerStatus, debuffMapValue] = await Promise.all([
@@ -102,7 +103,7 @@ export const usePlayerConstructStats = ({
                 blocksLeftUntilNextAttack: playerStatus?.blocksLeftUntilNextAttack ?? 0,
                 canAttack: playerStatus?.canPlayerAttack ?? true,
             };
-        },
+        }),
         enabled: !!ledger && !!contractId && !!userAccountId,
         staleTime: 15 * 1000,
         refetchInterval: POLLING_INTERVALS.userCooldown,
@@ -1,6 +1,7 @@
 import { useQuery } from '@tanstack/react-query';
 import { POLLING_INTERVALS } from '@lib/construct/constants';
 import { useSignumLedger } from './useSignumLedger';
+import { timeConstructHook } from '@lib/metrics';
 
 interface TokenBalancesData {
     balances: Record<string, number>;
@@ -23,7 +24,7 @@ export const useTokenBalances = (
 
     const { data, isLoading, error, refetch } = useQuery<TokenBalancesData>({
         queryKey: ['tokenBalances', accountId, tokenIds],
-        queryFn: async () => {
+        queryFn: () => timeConstructHook('useTokenBalances', async () => {
             const account = await ledger!.account.getAccount({ accountId: accountId! });
 
             const signaBalance = parseInt(account.balanceNQT || '0') / 1e8;
@@ -43,7 +44,7 @@ export const useTokenBalances = (
             }
 
             return { balances: tokenBalances, signaBalance };
-        },
+        }),
         enabled: !!ledger && !!accountId,
         staleTime: POLLING_INTERVALS.tokenBalances / 2,
         refetchInterval: POLLING_INTERVALS.tokenBalances,
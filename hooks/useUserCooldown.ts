@@ -2,6 +2,7 @@ import { useQuery } from '@tanstack/react-query';
 import { UserCooldownStatus } from '@lib/construct/types';
 import { ContractMaps, POLLING_INTERVALS, BLOCK_TIME_MS } from '@lib/construct/constants';
 import { useSignumLedger } from './useSignumLedger';
+import { timeConstructHook } from '@lib/metrics';
 
 export const useUserCooldown = (
     contractId: string | null,
@@ -12,7 +13,7 @@ export const useUserCooldown = (
 
     const { data: status = null } = useQuery({
         queryKey: ['userCooldown', contractId, userAccountId, cooldownBlocks],
-        queryFn: async () => {
+        queryFn: () => timeConstructHook('useUserCooldown', async () => {
             if (!ledger || !contractId || !userAccountId || cooldownBlocks <= 0) {
                 return null;
             }
@@ -61,7 +62,7 @@ export const useUserCooldown = (
                     cooldownEndsAt: null,
                 };
             }
-        },
+        }),
         enabled: !!ledger && !!contractId && !!userAccountId && cooldownBlocks > 0,
         staleTime: 15 * 1000,
         refetchInterval: POLLING_INTERVALS.userCooldown,
@@ -0,0 +1,87 @@
+import { describe, it, expect, beforeEach } from 'vitest';
+import { countCacheLookup, mergeClientSnapshot, Metrics, observe, renderPrometheus, resetMetrics, BUCKETS } from '../metrics';
+
+beforeEach(() => {
+    resetMetrics();
+});
+
+describe('renderPrometheus', () => {
+    it('renders cumulative histogram buckets', () => {
+        observe(Metrics.ScorePhase, { phase: 'loop' }, 0.003);
+        observe(Metrics.ScorePhase, { phase: 'loop' }, 0.2);
+        observe(Metrics.ScorePhase, { phase: 'loop' }, 60);
+
+        const text = renderPrometheus();
+        expect(text).toContain('# TYPE signarank_score_phase_duration_seconds histogram');
+        expect(text).toContain('signarank_score_phase_duration_seconds_bucket{phase="loop",le="0.005"} 1');
+        expect(text).toContain('signarank_score_phase_duration_seconds_bucket{phase="loop",le="0.25"} 2');
+        expect(text).toContain('signarank_score_phase_duration_seconds_bucket{phase="loop",le="30"} 2');
+        expect(text).toContain('signarank_score_phase_duration_seconds_bucket{phase="loop",le="+Inf"} 3');
+        expect(text).toContain('signarank_score_phase_duration_seconds_count{phase="loop"} 3');
+    });
+
+    it('renders cache counters by result', () => {
+        countCacheLookup('resolve_account', true);
+        countCacheLookup('resolve_account', true);
+        countCacheLookup('resolve_account', false);
+
+        const text = renderPrometheus();
+        expect(text).toContain('signarank_cache_lookups_total{cache="resolve_account",result="hit"} 2');
+        expect(text).toContain('signarank_cache_lookups_total{cache="resolve_account",result="miss"} 1');
+    });
+});
+
+describe('mergeClientSnapshot', () => {
+    const buckets = BUCKETS.map((_, i) => (i === 3 ? 2 : 0));
+
+    it('merges client hook timings and cache counters into the client metrics', () => {
+        const merged = mergeClientSnapshot({
+            histograms: [{ name: Metrics.ConstructHook, labels: { hook: 'useConstruct' }, buckets, sum: 0.08, count: 2 }],
+            counters: [{ name: Metrics.ClientCacheLookups, labels: { cache: 'construct_meta', result: 'hit' }, value: 5 }],
+        });
+        expect(merged).toBe(2);
+
+        const text = renderPrometheus();
+        expect(text).toContain('signarank_client_construct_hook_duration_seconds_count{hook="useConstruct"} 2');
+        expect(text).toContain('signarank_client_cache_lookups_total{cache="construct_meta",result="hit"} 5');
+    });
+
+    it('never touches the server metrics', () => {
+        countCacheLookup('resolve_account', true);
+        const merged = mergeClientSnapshot({
+            histograms: [{ name: Metrics.ScorePhase, labels: { phase: 'loop' }, buckets, sum: 1, count: 2 }],
+            counters: [
+                { name: Metrics.CacheLookups, labels: { cache: 'resolve_account', result: 'hit' }, value: 100 },
+                { name: Metrics.ClientCacheLookups, labels: { cache: 'resolve_account', result: 'hit' }, value: 100 },
+            ],
+        });
+        expect(merged).toBe(1);
+        const text = renderPrometheus();
+        expect(text).toContain('signarank_cache_lookups_total{cache="resolve_account",result="hit"} 1');
+        expect(text).toContain('signarank_client_cache_lookups_total{cache="resolve_account",result="hit"} 100');
+        expect(text).not.toContain('signarank_score_phase_duration_seconds');
+    });
+
+    it('drops unknown label values and malformed series', () => {
+        const merged = mergeClientSnapshot({
+            histograms: [
+                { name: Metrics.ConstructHook, labels: { hook: 'useSomethingElse' }, buckets, sum: 1, count: 2 },
+                { name: Metrics.ConstructHook, labels: { hook: 'useConstruct', le: '1' }, buckets, sum: 1, count: 2 },
+                { name: Metrics.ConstructHook, labels: { hook: 'useConstruct' }, buckets: [1], sum: 1, count: 1 },
+            ],
+            counters: [{ name: Metrics.ClientCacheLookups, labels: { cache: 'construct_meta', result: 'hit' }, value: -1 }],
+        });
+        expect(merged).toBe(0);
+        expect(renderPrometheus()).toBe('\n');
+    });
+
+    it('keeps recording server series however much clients report', () => {
+        for (let i = 0; i < 1000; i++) {
+            mergeClientSnapshot({
+                histograms: [{ name: Metrics.ConstructHook, labels: { hook: `hook_${i}` }, buckets, sum: 1, count: 2 }],
+            });
+        }
+        observe(Metrics.NodeCall, { method: 'getAccount' }, 0.1);
+        expect(renderPrometheus()).toContain('signarank_node_call_duration_seconds_count{method="getAccount"} 1');
+    });
+});
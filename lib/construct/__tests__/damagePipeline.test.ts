@@ -0,0 +1,65 @@
+import { describe, it, expect } from 'vitest';
+import { computeDamagePreview, type DamagePreviewInput, type TokenModifier } from '../damagePipeline';
+
+const SIGNA = 100000000;
+
+function modifier(overrides: Partial<Record<keyof TokenModifier, number>>): TokenModifier {
+    return {
+        multiplier: BigInt(overrides.multiplier ?? 0),
+        addition: BigInt(overrides.addition ?? 0),
+        tokenLimit: BigInt(overrides.tokenLimit ?? 0),
+        decimals: BigInt(overrides.decimals ?? 0),
+    };
+}
+
+function makeInput(overrides: Partial<DamagePreviewInput> = {}, construct: Partial<DamagePreviewInput['construct']> = {}): DamagePreviewInput {
+    return {
+        amount: BigInt(100 * SIGNA),
+        tokens: [],
+        debuffStacks: 0,
+        modifiers: {},
+        ...overrides,
+        construct: {
+            baseDamageRatio: 10,
+            breachLimit: 20,
+            maxHp: 50000,
+            currentHp: 50000,
+            debuffDamageReduction: 0,
+            debuffMaxStack: 0,
+            ...construct,
+        },
+    };
+}
+
+const one = (tokenId: string, quantity = 1) => ({ tokenId, quantity: BigInt(quantity) });
+
+// the damage math is covered by smartcontracts/construct/game-mechanics/damage-model.test.ts and the differential run
+describe('computeDamagePreview', () => {
+    it('only counts the first 4 attached tokens', () => {
+        const modifiers = { p: modifier({ addition: 100 }), q: modifier({ addition: 1000 }) };
+        const tokens = [one('p'), one('p'), one('p'), one('p'), one('q')];
+        const preview = computeDamagePreview(makeInput({ tokens, modifiers }));
+        expect(preview.effectiveDamage).toBe(410);
+        expect(preview.tokenDamage).toBe(410);
+    });
+
+    it('reports tokens without modifiers as ineffective', () => {
+        const modifiers = { p: modifier({ addition: 100 }) };
+        const preview = computeDamagePreview(makeInput({ tokens: [one('unknown'), one('p'), one('none', 0)], modifiers }));
+        expect(preview.ineffectiveTokenIds).toEqual(['unknown']);
+        expect(preview.effectiveDamage).toBe(110);
+    });
+
+    it('flags debuffed attacks', () => {
+        const construct = { debuffDamageReduction: 30, debuffMaxStack: 3 };
+        expect(computeDamagePreview(makeInput({ debuffStacks: 1 }, construct)).isDebuffed).toBe(true);
+        expect(computeDamagePreview(makeInput({ debuffStacks: 0 }, construct)).isDebuffed).toBe(false);
+    });
+
+    it('flags the final blow', () => {
+        const preview = computeDamagePreview(makeInput({}, { currentHp: 5 }));
+        expect(preview.isFinalBlow).toBe(true);
+        expect(preview.effectiveDamage).toBe(5);
+        expect(computeDamagePreview(makeInput({}, { currentHp: 11 })).isFinalBlow).toBe(false);
+    });
+});
@@ -0,0 +1,163 @@
+import { describe, it, expect } from 'vitest';
+import {
+    applyConstructTransfers,
+    rankHolders,
+    settleCrawlTransfers,
+    settleTransfersSince,
+    type XpBalance,
+    type XpHolder,
+    type XpTransfer
+} from '../xpLeaderboard';
+
+const CONSTRUCT = '999';
+
+function makeHolder(account: string, xp: number): XpHolder {
+    return { account, accountRS: `S-${account}`, name: null, xp };
+}
+
+function makeTransfer(id: string, sender: string, recipient: string, quantity: number): XpTransfer {
+    return { assetTransfer: id, sender, recipient, recipientRS: `S-${recipient}`, quantityQNT: String(quantity) };
+}
+
+describe('rankHolders', () => {
+    it('ranks by xp descending', () => {
+        const ranked = rankHolders([makeHolder('1', 10), makeHolder('2', 30), makeHolder('3', 20)]);
+        expect(ranked.map(e => e.account)).toEqual(['2', '3', '1']);
+        expect(ranked.map(e => e.rank)).toEqual([1, 2, 3]);
+    });
+
+    it('drops holders without xp', () => {
+        const ranked = rankHolders([makeHolder('1', 0), makeHolder('2', 5)]);
+        expect(ranked).toHaveLength(1);
+        expect(ranked[0].account).toBe('2');
+    });
+});
+
+describe('applyConstructTransfers', () => {
+    it('credits construct transfers to known holders', () => {
+        const holders = new Map([['1', makeHolder('1', 10)]]);
+        const newAccounts = applyConstructTransfers(
+            holders,
+            [makeTransfer('t1', CONSTRUCT, '1', 5)],
+            new Set([CONSTRUCT]),
+            new Set(),
+        );
+        expect(holders.get('1')!.xp).toBe(15);
+        expect(newAccounts).toEqual([]);
+    });
+
+    it('adds unknown recipients as new holders', () => {
+        const holders = new Map<string, XpHolder>();
+        const newAccounts = applyConstructTransfers(
+            holders,
+            [makeTransfer('t1', CONSTRUCT, '2', 7)],
+            new Set([CONSTRUCT]),
+            new Set(),
+        );
+        expect(holders.get('2')?.xp).toBe(7);
+        expect(newAccounts).toEqual(['2']);
+    });
+
+    it('ignores transfers not sent by constructs and excluded recipients', () => {
+        const holders = new Map([['1', makeHolder('1', 10)]]);
+        applyConstructTransfers(
+            holders,
+            [makeTransfer('t1', '42', '1', 5), makeTransfer('t2', CONSTRUCT, '3', 5)],
+            new Set([CONSTRUCT]),
+            new Set(['3']),
+        );
+        expect(holders.get('1')!.xp).toBe(10);
+        expect(holders.has('3')).toBe(false);
+    });
+});
+
+describe('settleCrawlTransfers', () => {
+    it('never applies a transfer the crawl already counted', () => {
+        // t2 was confirmed during the crawl, so the crawled balance of 15 already contains it
+        const holders = new Map([['1', makeHolder('1', 15)]]);
+        const crawlTransfers = [makeTransfer('t2', CONSTRUCT, '1', 5)];
+        const balances = new Map<string, XpBalance>([['1', { accountRS: 'S-1', xp: 15 }]]);
+
+        const { lastTransferId } = settleCrawlTransfers(holders, crawlTransfers, balances, new Set([CONSTRUCT]), 't1');
+        // incremental syncs start after t2 instead of re-applying it
+        expect(lastTransferId).toBe('t2');
+        expect(holders.get('1')!.xp).toBe(15);
+    });
+
+    it('takes the re-read balance if the crawl missed a transfer', () => {
+        const holders = new Map([['1', makeHolder('1', 10)]]);
+        const balances = new Map<string, XpBalance>([
+            ['1', { accountRS: 'S-1', xp: 15 }],
+            ['2', { accountRS: 'S-2', xp: 3 }],
+        ]);
+
+        const { newAccounts } = settleCrawlTransfers(
+            holders,
+            [makeTransfer('t3', CONSTRUCT, '2', 3), makeTransfer('t2', CONSTRUCT, '1', 5)],
+            balances,
+            new Set([CONSTRUCT]),
+            't1',
+        );
+        expect(holders.get('1')!.xp).toBe(15);
+        expect(holders.get('2')?.xp).toBe(3);
+        expect(newAccounts).toEqual(['2']);
+    });
+
+    it('keeps the sync point and drops emptied holders', () => {
+        const holders = new Map([['1', makeHolder('1', 10)]]);
+        const balances = new Map<string, XpBalance>([['1', { accountRS: 'S-1', xp: 0 }]]);
+        expect(settleCrawlTransfers(holders, [], new Map(), new Set(), 't1').lastTransferId).toBe('t1');
+        settleCrawlTransfers(holders, [makeTransfer('t2', '1', '4', 10)], balances, new Set(), 't1');
+        expect(holders.has('1')).toBe(false);
+    });
+});
+
+describe('settleTransfersSince', () => {
+    it('settles transfers confirmed while the balances were re-read', async () => {
+        // t2 was confirmed during the crawl, t3 after t2 was fetched but before the balance was re-read
+        const holders = new Map([['1', makeHolder('1', 10)]]);
+        const transfers: Record<string, XpTransfer[]> = {
+            t1: [makeTransfer('t2', CONSTRUCT, '1', 5)],
+            t2: [makeTransfer('t3', CONSTRUCT, '1', 4)],
+            t3: [],
+        };
+        const balanceReads: string[][] = [];
+
+        const lastTransferId = await settleTransfersSince(
+            holders,
+            new Set([CONSTRUCT]),
+            't1',
+            async since => transfers[since!],
+            async accountIds => {
+                balanceReads.push(accountIds);
+                return new Map<string, XpBalance>([['1', { accountRS: 'S-1', xp: 19 }]]);
+            },
+        );
+
+        // the re-read balance contains t3, so incremental syncs must start after it
+        expect(lastTransferId).toBe('t3');
+        expect(holders.get('1')!.xp).toBe(19);
+        expect(balanceReads).toEqual([['1'], ['1']]);
+        applyConstructTransfers(holders, transfers[lastTransferId!], new Set([CONSTRUCT]), new Set());
+        expect(holders.get('1')!.xp).toBe(19);
+    });
+
+    it('gives up on a sync point if transfers keep arriving', async () => {
+        const holders = new Map([['1', makeHolder('1', 10)]]);
+        let n = 1;
+        const lastTransferId = await settleTransfersSince(
+            holders,
+            new Set(),
+            't1',
+            async () => [makeTransfer(`t${++n}`, CONSTRUCT, '1', 1)],
+            async () => new Map<string, XpBalance>([['1', { accountRS: 'S-1', xp: 10 + n }]]),
+        );
+        expect(lastTransferId).toBeNull();
+    });
+
+    it('gives up on a sync point if there are too many transfers', async () => {
+        const holders = new Map([['1', makeHolder('1', 10)]]);
+        expect(await settleTransfersSince(holders, new Set(), 't1', async () => null, async () => new Map())).toBeNull();
+        expect(holders.get('1')!.xp).toBe(10);
+    });
+});
@@ -1,4 +1,5 @@
 import {type Account, Ledger} from '@signumjs/core';
+import {countCacheLookup} from '@lib/metrics';
 
 const TTL_MS = 120_000;
 
@@ -11,7 +12,9 @@ const cache = new Map<string, CacheEntry>();
 
 export async function resolveAccount(ledger: Ledger, accountId: string): Promise<Account|null> {
     const cached = cache.get(accountId);
-    if (cached && cached.expiresAt > Date.now()) return cached.account;
+    const hit = !!cached && cached.expiresAt > Date.now();
+    countCacheLookup('resolve_account', hit);
+    if (hit) return cached!.account;
 
     try {
         const account = await ledger.account.getAccount({accountId});
@@ -4,6 +4,7 @@
  */
 
 import { ConstructMeta, DefeatedStatus, TokenMeta } from './types';
+import { countCacheLookup } from '@lib/metrics';
 
 const CACHE_PREFIX = 'signarank';
 
@@ -23,6 +24,13 @@ function getItem<T>(key: string): T | null {
     }
 }
 
+function getCountedItem<T>(cache: string, key: string): T | null {
+    if (typeof window === 'undefined') return null;
+    const item = getItem<T>(key);
+    countCacheLookup(cache, item !== null);
+    return item;
+}
+
 function setItem<T>(key: string, value: T): void {
     if (typeof window === 'undefined') return;
     try {
@@ -44,7 +52,7 @@ function removeItem(key: string): void {
 export const ConstructCache = {
     // Token metadata (permanent - token metadata doesn't change)
     getTokenMeta(tokenId: string): TokenMeta | null {
-        return getItem<TokenMeta>(CacheKeys.tokenMeta(tokenId));
+        return getCountedItem<TokenMeta>('construct_token_meta', CacheKeys.tokenMeta(tokenId));
     },
 
     setTokenMeta(tokenId: string, meta: TokenMeta): void {
@@ -53,7 +61,7 @@ export const ConstructCache = {
 
     // Construct metadata (permanent - static contract data)
     getConstructMeta(contractId: string): ConstructMeta | null {
-        return getItem<ConstructMeta>(CacheKeys.constructMeta(contractId));
+        return getCountedItem<ConstructMeta>('construct_meta', CacheKeys.constructMeta(contractId));
     },
 
     setConstructMeta(contractId: string, meta: ConstructMeta): void {
@@ -39,6 +39,9 @@ export const ContractMaps = {
     TokenDecimalsInfo: 3,
 } as const;
 
+// Registered token decimals are stored with this flag added, as 0 is a valid decimal value
+export const MAP_SET_FLAG = 1024;
+
 // R2 CDN base URL for construct images
 export const R2_CDN_BASE = 'https://r2.signarank.club';
 
@@ -0,0 +1,65 @@
+/**
+ * Damage preview engine
+ *
+ * Loads the per-token modifiers of a construct from the contract maps once, caches them in memory,
+ * and feeds them to the contract damage pipeline (see ./damagePipeline).
+ */
+
+import {Ledger} from '@signumjs/core';
+import {ContractMaps, MAP_SET_FLAG} from './constants';
+import {DamageModifiers} from './damagePipeline';
+
+const TTL_MS = 10 * 60 * 1000;
+const ZERO = BigInt(0);
+
+async function readMap(ledger: Ledger, contractId: string, mapId: number): Promise<Map<string, bigint>> {
+    const {keyValues = []} = await ledger.contract.getContractMapValuesByFirstKey({
+        contractId,
+        key1: mapId.toString(),
+    });
+    return new Map(keyValues.map(kv => [kv.key2, BigInt(kv.value || '0')]));
+}
+
+async function fetchDamageModifiers(ledger: Ledger, contractId: string): Promise<DamageModifiers> {
+    const [multipliers, additions, limits, decimals] = await Promise.all([
+        readMap(ledger, contractId, ContractMaps.DamageMultiplier),
+        readMap(ledger, contractId, ContractMaps.DamageAddition),
+        readMap(ledger, contractId, ContractMaps.DamageTokenLimit),
+        readMap(ledger, contractId, ContractMaps.TokenDecimalsInfo),
+    ]);
+
+    const flag = BigInt(MAP_SET_FLAG);
+    const tokenIds = new Set<string>();
+    [multipliers, additions, limits, decimals].forEach(map => map.forEach((_, tokenId) => tokenIds.add(tokenId)));
+    const modifiers: DamageModifiers = {};
+    tokenIds.forEach(tokenId => {
+        const decimalsInfo = decimals.get(tokenId) ?? ZERO;
+        modifiers[tokenId] = {
+            multiplier: multipliers.get(tokenId) ?? ZERO,
+            addition: additions.get(tokenId) ?? ZERO,
+            tokenLimit: limits.get(tokenId) ?? ZERO,
+            decimals: decimalsInfo >= flag ? decimalsInfo - flag : ZERO,
+        };
+    });
+    return modifiers;
+}
+
+interface CacheEntry {
+    modifiers: Promise<DamageModifiers>;
+    expiresAt: number;
+}
+
+const cache = new Map<string, CacheEntry>();
+
+/**
+ * Loads the token modifiers of a construct - cached, concurrent callers share one request.
+ */
+export function loadDamageModifiers(ledger: Ledger, contractId: string): Promise<DamageModifiers> {
+    const cached = cache.get(contractId);
+    if (cached && cached.expiresAt > Date.now()) return cached.modifiers;
+
+    const modifiers = fetchDamageModifiers(ledger, contractId);
+    cache.set(contractId, {modifiers, expiresAt: Date.now() + TTL_MS});
+    modifiers.catch(() => cache.delete(contractId));
+    return modifiers;
+}
@@ -0,0 +1,157 @@
+/**
+ * Construct damage pipeline
+ *
+ * Computes the damage an attack deals, using the same integer math and order as the construct contract:
+ * signa damage -> token additions -> token multipliers -> debuff -> breach limit -> current HP.
+ * Free of app and ledger dependencies, so the contract differential run checks this exact code
+ * (smartcontracts/construct/reference/differential.ts).
+ */
+
+import type {ConstructData} from './types';
+
+export interface TokenModifier {
+    /** Damage multiplier in percent (0 = none, < 100 = resistance) */
+    multiplier: bigint;
+    /** Flat damage addition per whole token */
+    addition: bigint;
+    /** Max. counted whole tokens (0 = unlimited) */
+    tokenLimit: bigint;
+    /** Decimals registered in the contract (0 if unregistered) */
+    decimals: bigint;
+}
+
+export type DamageModifiers = Record<string, TokenModifier>;
+
+export interface PreviewToken {
+    tokenId: string;
+    /** Quantity in raw units (QNT) */
+    quantity: bigint;
+}
+
+export interface DamagePreviewInput {
+    /** Attack amount in Planck, without activation amount */
+    amount: bigint;
+    tokens: PreviewToken[];
+    construct: Pick<ConstructData, 'baseDamageRatio' | 'breachLimit' | 'maxHp' | 'currentHp' | 'debuffDamageReduction' | 'debuffMaxStack'>;
+    debuffStacks: number;
+    modifiers: DamageModifiers;
+}
+
+export interface DamagePreview {
+    signaDamage: number;
+    /** Damage after all token modifiers */
+    tokenDamage: number;
+    /** Damage before the breach limit */
+    preBreachDamage: number;
+    /** Damage the construct will take */
+    effectiveDamage: number;
+    breachLimitHit: boolean;
+    isDebuffed: boolean;
+    isFinalBlow: boolean;
+    /** Attached tokens the contract has no modifier for */
+    ineffectiveTokenIds: string[];
+}
+
+// contract math is signed 64-bit integer math
+const ZERO = BigInt(0);
+const ONE = BigInt(1);
+const TEN = BigInt(10);
+const HUNDRED = BigInt(100);
+const ONE_SIGNA = BigInt(100_000_000);
+const long = (n: bigint) => BigInt.asIntN(64, n);
+
+function pow10(exp: bigint): bigint {
+    // the contract caps decimals at 6 and falls back to 1 otherwise
+    if (exp < ZERO || exp > BigInt(6)) return ONE;
+    let result = ONE;
+    for (let i = ZERO; i < exp; i++) result *= TEN;
+    return result;
+}
+
+function limitQuantity(quantity: bigint, modifier: TokenModifier): bigint {
+    if (modifier.tokenLimit > ZERO) {
+        const tokenLimitRaw = long(modifier.tokenLimit * pow10(modifier.decimals));
+        if (quantity > tokenLimitRaw) return tokenLimitRaw;
+    }
+    return quantity;
+}
+
+function applyTokenAddition(quantity: bigint, modifier: TokenModifier): bigint {
+    if (quantity === ZERO || modifier.addition === ZERO) return ZERO;
+    return long(modifier.addition * limitQuantity(quantity, modifier)) / pow10(modifier.decimals);
+}
+
+function applyTokenMultiplier(damage: bigint, quantity: bigint, modifier: TokenModifier): bigint {
+    const {multiplier} = modifier;
+    if (quantity === ZERO || multiplier === ZERO) return damage;
+
+    const limited = limitQuantity(quantity, modifier);
+    const p = pow10(modifier.decimals);
+
+    if (multiplier < HUNDRED) {
+        // resistance: each whole token applies multiplicatively, fractions interpolate linearly
+        const quantityInt = limited / p;
+        for (let i = ZERO; i < quantityInt && damage !== ZERO; i++) {
+            damage = long(damage * multiplier) / HUNDRED;
+        }
+        const fractional = limited % p;
+        if (fractional > ZERO) {
+            const fractionalMultiplier = HUNDRED - long((HUNDRED - multiplier) * fractional) / p;
+            damage = long(damage * fractionalMultiplier) / HUNDRED;
+        }
+        return damage;
+    }
+    return long((long(damage * multiplier) / HUNDRED) * limited) / p;
+}
+
+function applyDebuff(damage: bigint, stacks: bigint, damageReduction: bigint, maxStack: bigint): bigint {
+    if (stacks <= ZERO) return damage;
+    if (maxStack > ZERO && stacks > maxStack) stacks = maxStack;
+    const modified = long(damage * long(HUNDRED - long(stacks * damageReduction))) / HUNDRED;
+    return modified < ZERO ? ZERO : modified;
+}
+
+const NO_MODIFIER: TokenModifier = {multiplier: ZERO, addition: ZERO, tokenLimit: ZERO, decimals: ZERO};
+
+export function computeDamagePreview({amount, tokens, construct, debuffStacks, modifiers}: DamagePreviewInput): DamagePreview {
+    const attached = tokens.slice(0, 4).map(t => ({...t, modifier: modifiers[t.tokenId] ?? NO_MODIFIER}));
+
+    const signaDamage = long(amount * BigInt(construct.baseDamageRatio)) / (HUNDRED * ONE_SIGNA);
+
+    let damage = signaDamage;
+    let totalAddition = ZERO;
+    for (const t of attached) totalAddition = long(totalAddition + applyTokenAddition(t.quantity, t.modifier));
+    damage = long(damage + totalAddition);
+    for (const t of attached) damage = applyTokenMultiplier(damage, t.quantity, t.modifier);
+    const tokenDamage = damage;
+
+    const stacks = BigInt(debuffStacks);
+    if (stacks > ZERO) {
+        damage = applyDebuff(damage, stacks, BigInt(construct.debuffDamageReduction), BigInt(construct.debuffMaxStack));
+    }
+
+    const preBreachDamage = damage;
+    const breachLimit = BigInt(construct.breachLimit);
+    if (breachLimit > ZERO) {
+        const maxDamage = long(BigInt(construct.maxHp) * breachLimit) / HUNDRED;
+        if (damage > maxDamage) damage = maxDamage;
+    }
+    const breachLimitHit = damage < preBreachDamage;
+
+    const currentHp = BigInt(construct.currentHp);
+    const isFinalBlow = damage >= currentHp;
+    if (isFinalBlow) damage = currentHp;
+
+    return {
+        signaDamage: Number(signaDamage),
+        tokenDamage: Number(tokenDamage),
+        preBreachDamage: Number(preBreachDamage),
+        effectiveDamage: Number(damage),
+        breachLimitHit,
+        isDebuffed: stacks > ZERO,
+        isFinalBlow,
+        ineffectiveTokenIds: attached
+            .filter(t => t.quantity > ZERO && t.modifier.multiplier === ZERO && t.modifier.addition === ZERO)
+            .map(t => t.tokenId),
+    };
+}
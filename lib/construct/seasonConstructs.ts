@@ -36,3 +36,21 @@ export function getSeasonNameForContract(contractId: string): string | null {
     }
     return null;
 }
+
+/**
+ * All construct contract ids known across every season and network,
+ * including the placeholders for future constructs.
+ */
+export function getAllConstructIds(): Set<string> {
+    const ids = new Set<string>();
+    for (const season of Object.values(seasons)) {
+        for (const networkIds of Object.values(season.constructs)) {
+            for (const id of networkIds as string[]) ids.add(id);
+        }
+        for (const networkIds of Object.values(season.pastConstructs)) {
+            for (const id of networkIds as string[]) ids.add(id);
+        }
+        for (const id of season.futureConstructs as string[]) ids.add(id);
+    }
+    return ids;
+}
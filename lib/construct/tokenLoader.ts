@@ -1,42 +1,12 @@
-import {type Asset, Ledger} from '@signumjs/core';
+import {Ledger} from '@signumjs/core';
 import {TokenMeta} from './types';
 import {ConstructCache} from './cache';
-import {src44} from "@signumjs/standards"
-import {Config} from "@components/contexts/AppContext";
-
-function getTokenDescriptor(asset: Asset) {
-    try {
-        const descriptor = src44.DescriptorData.parse(asset.description, false);
-        return {
-            description: descriptor.description,
-            iconUrl: descriptor.avatar?.ipfsCid ? Config.Ipfs.Gateway + '/' + descriptor.avatar.ipfsCid : undefined,
-        }
-    } catch {
-        return {
-            description: asset.description,
-            iconUrl: undefined,
-        }
-    }
-}
-
-export async function loadTokenMeta(ledger: Ledger, tokenId: string): Promise<TokenMeta> {
-    // Check cache first
-    const cached = ConstructCache.getTokenMeta(tokenId);
-    if (cached) {
-        return cached;
-    }
+import {MAX_TOKEN_META_BATCH, toTokenMeta} from './tokenMeta';
 
+async function fetchTokenMeta(ledger: Ledger, tokenId: string): Promise<TokenMeta> {
     try {
         const asset = await ledger.asset.getAsset({assetId: tokenId});
-        const {description, iconUrl} = getTokenDescriptor(asset)
-        const meta: TokenMeta = {
-            tokenId,
-            name: asset.name,
-            symbol: asset.name, // Use name as symbol for now
-            decimals: asset.decimals,
-            description,
-            iconUrl,
-        };
+        const meta = toTokenMeta(tokenId, asset);
         ConstructCache.setTokenMeta(tokenId, meta);
         return meta;
     } catch (error) {
@@ -51,9 +21,72 @@ export async function loadTokenMeta(ledger: Ledger, tokenId: string): Promise<To
     }
 }
 
+export async function loadTokenMeta(ledger: Ledger, tokenId: string): Promise<TokenMeta> {
+    // Check cache first
+    const cached = ConstructCache.getTokenMeta(tokenId);
+    if (cached) {
+        return cached;
+    }
+    return fetchTokenMeta(ledger, tokenId);
+}
+
+let pendingIds = new Set<string>();
+let pendingBatch: Promise<Record<string, TokenMeta>> | null = null;
+
+async function fetchTokenMetaBatch(tokenIds: string[]): Promise<Record<string, TokenMeta>> {
+    const result: Record<string, TokenMeta> = {};
+    for (let i = 0; i < tokenIds.length; i += MAX_TOKEN_META_BATCH) {
+        // sorted, so the same set of tokens hits the same CDN entry
+        const ids = tokenIds.slice(i, i + MAX_TOKEN_META_BATCH).sort();
+        const res = await fetch(`/api/asset/meta?ids=${ids.join(',')}`);
+        if (!res.ok) throw new Error(`Token metadata request failed: ${res.status}`);
+        const {tokens} = await res.json() as { tokens: TokenMeta[] };
+        tokens.forEach(meta => result[meta.tokenId] = meta);
+    }
+    return result;
+}
+
+/**
+ * Queues token ids for the server batch - all ids requested in the same tick share one request.
+ */
+function requestTokenMetaBatch(tokenIds: string[]): Promise<Record<string, TokenMeta>> {
+    tokenIds.forEach(id => pendingIds.add(id));
+    if (!pendingBatch) {
+        pendingBatch = Promise.resolve().then(() => {
+            const ids = Array.from(pendingIds);
+            pendingIds = new Set();
+            pendingBatch = null;
+            return fetchTokenMetaBatch(ids);
+        });
+    }
+    return pendingBatch;
+}
+
 export async function loadMultipleTokenMeta(ledger: Ledger, tokenIds: string[]): Promise<TokenMeta[]> {
-    const results = await Promise.all(
-        tokenIds.map(id => loadTokenMeta(ledger, id))
+    const found: Record<string, TokenMeta> = {};
+    const missing: string[] = [];
+    tokenIds.forEach(id => {
+        const cached = ConstructCache.getTokenMeta(id);
+        if (cached) found[id] = cached;
+        else missing.push(id);
+    });
+
+    if (missing.length > 0) {
+        try {
+            const batch = await requestTokenMetaBatch(missing);
+            missing.forEach(id => {
+                const meta = batch[id];
+                if (!meta) return;
+                ConstructCache.setTokenMeta(id, meta);
+                found[id] = meta;
+            });
+        } catch (error) {
+            console.warn('Batched token metadata failed, loading from node:', error);
+        }
+    }
+
+    // anything the server could not provide is loaded from the node directly - the cache was checked above
+    return Promise.all(
+        tokenIds.map(id => found[id] ?? fetchTokenMeta(ledger, id))
     );
-    return results;
 }
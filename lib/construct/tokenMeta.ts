@@ -0,0 +1,38 @@
+/**
+ * Token metadata mapping, shared by the browser loader and the server store
+ * (no UI or browser dependencies).
+ */
+
+import {type Asset} from '@signumjs/core';
+import {src44} from "@signumjs/standards"
+import {IPFS_GATEWAY} from '@lib/ipfsConfig';
+import {TokenMeta} from './types';
+
+export const MAX_TOKEN_META_BATCH = 50;
+
+function getTokenDescriptor(asset: Asset) {
+    try {
+        const descriptor = src44.DescriptorData.parse(asset.description, false);
+        return {
+            description: descriptor.description,
+            iconUrl: descriptor.avatar?.ipfsCid ? IPFS_GATEWAY + '/' + descriptor.avatar.ipfsCid : undefined,
+        }
+    } catch {
+        return {
+            description: asset.description,
+            iconUrl: undefined,
+        }
+    }
+}
+
+export function toTokenMeta(tokenId: string, asset: Asset): TokenMeta {
+    const {description, iconUrl} = getTokenDescriptor(asset)
+    return {
+        tokenId,
+        name: asset.name,
+        symbol: asset.name, // Use name as symbol for now
+        decimals: asset.decimals,
+        description,
+        iconUrl,
+    };
+}
@@ -0,0 +1,98 @@
+/**
+ * Server-side token metadata store
+ *
+ * Shared, long-lived cache of token metadata with the SRC44 descriptor already parsed,
+ * so visitors get the metadata of all power-ups in one request instead of one node call each.
+ * Token name, decimals and descriptor do not change after issuance.
+ *
+ * The batch endpoint is public, so ids that fail to load are remembered for a few minutes,
+ * node calls are limited in concurrency and the store is capped in size.
+ */
+
+import {LedgerClientFactory} from '@signumjs/core';
+import {countCacheLookup, timeNodeCall} from '@lib/metrics';
+import {toTokenMeta} from './tokenMeta';
+import {TokenMeta} from './types';
+
+const TTL_MS = 24 * 60 * 60 * 1000;
+const FAILED_TTL_MS = 5 * 60 * 1000;
+const MAX_ENTRIES = 5000;
+const FETCH_CONCURRENCY = 8;
+
+interface CacheEntry {
+    /** null for tokens that failed to load */
+    meta: TokenMeta | null;
+    expiresAt: number;
+}
+
+const toStringArray = (csv: any = ""): Array<string> => csv.split(",").filter(Boolean);
+
+const ledger = LedgerClientFactory.createClient({
+    nodeHost: process.env.NEXT_PUBLIC_SIGNUM_DEFAULT_NODE || "",
+    reliableNodeHosts: toStringArray(process.env.NEXT_PUBLIC_SIGNUM_RELIABLE_NODES)
+})
+
+const cache = new Map<string, CacheEntry>();
+const pending = new Map<string, Promise<TokenMeta | null>>();
+
+let activeFetches = 0;
+const waiting: Array<() => void> = [];
+
+async function withFetchSlot<T>(fn: () => Promise<T>): Promise<T> {
+    if (activeFetches < FETCH_CONCURRENCY) {
+        activeFetches++;
+    } else {
+        // the slot is handed over by the finishing fetch
+        await new Promise<void>(resolve => waiting.push(resolve));
+    }
+    try {
+        return await fn();
+    } finally {
+        const next = waiting.shift();
+        if (next) next();
+        else activeFetches--;
+    }
+}
+
+function store(tokenId: string, meta: TokenMeta | null, ttl: number) {
+    cache.delete(tokenId);
+    if (cache.size >= MAX_ENTRIES) {
+        // maps iterate in insertion order - drop the oldest entry
+        cache.delete(cache.keys().next().value as string);
+    }
+    cache.set(tokenId, {meta, expiresAt: Date.now() + ttl});
+}
+
+function fetchTokenMeta(tokenId: string): Promise<TokenMeta | null> {
+    let promise = pending.get(tokenId);
+    if (!promise) {
+        promise = withFetchSlot(() => timeNodeCall('getAsset', () => ledger.asset.getAsset({assetId: tokenId})))
+            .then(asset => {
+                const meta = toTokenMeta(tokenId, asset);
+                store(tokenId, meta, TTL_MS);
+                return meta;
+            })
+            .catch(e => {
+                console.error(`tokenMetaStore: failed to load ${tokenId}:`, e);
+                store(tokenId, null, FAILED_TTL_MS);
+                return null;
+            })
+            .finally(() => pending.delete(tokenId));
+        pending.set(tokenId, promise);
+    }
+    return promise;
+}
+
+/**
+ * Returns the metadata of the given tokens - unknown or failed tokens are left out.
+ */
+export async function getTokenMetas(tokenIds: string[]): Promise<TokenMeta[]> {
+    const now = Date.now();
+    const metas = await Promise.all(tokenIds.map(tokenId => {
+        const cached = cache.get(tokenId);
+        const hit = !!cached && cached.expiresAt > now;
+        countCacheLookup('token_meta_store', hit);
+        return hit ? cached!.meta : fetchTokenMeta(tokenId);
+    }));
+    return metas.filter((meta): meta is TokenMeta => meta !== null);
+}
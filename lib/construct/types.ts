@@ -103,3 +103,18 @@ export interface AttackResult {
     error?: string;
     cancelled?: boolean;
 }
+
+export interface XpLeaderboardEntry {
+    rank: number;
+    account: string;
+    accountRS: string;
+    name: string | null;
+    xp: number;
+}
+
+export interface XpLeaderboardPage {
+    entries: XpLeaderboardEntry[];
+    total: number;
+    /** Epoch millis of the last holder update */
+    updatedAt: number;
+}
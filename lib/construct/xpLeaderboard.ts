@@ -0,0 +1,421 @@
+/**
+ * Server-side XP leaderboard
+ *
+ * Keeps the ranked list of XP token holders in memory, so visitors are served
+ * from a prepared ranking instead of each browser crawling the ledger.
+ *
+ * - A full sync pages through all XP token holders (periodically, to catch trades and
+ *   transfers between players)
+ * - In between, only the new XP transfers sent by constructs are applied on top
+ * - Account names are resolved once per holder in the background and filled in when ready,
+ *   so a ranking is served as soon as the balances are known
+ */
+
+import {Ledger, LedgerClientFactory} from '@signumjs/core';
+import {CACHE_TTL_MS} from '@lib/cacheConfig';
+import {resolveAccount} from './accountCache';
+import {BLOCK_TIME_MS, getSignaRankTokenId} from './constants';
+import {getAllConstructIds} from './seasonConstructs';
+import {XpLeaderboardEntry, XpLeaderboardPage} from './types';
+
+const HOLDERS_PAGE_SIZE = 500;
+const TRANSFERS_PAGE_SIZE = 100;
+// beyond this many pages of new transfers a full sync is cheaper
+const MAX_TRANSFER_PAGES = 5;
+// transfers keep arriving while balances are re-read - give up on a clean sync point after this many rounds
+const MAX_SETTLE_ROUNDS = 5;
+const RESOLVE_CONCURRENCY = 8;
+const INCREMENTAL_REFRESH_MS = BLOCK_TIME_MS / 4;
+const FULL_SYNC_MS = CACHE_TTL_MS;
+
+export const MAX_PAGE_SIZE = 100;
+
+export interface XpHolder {
+    account: string;
+    accountRS: string;
+    name: string | null;
+    xp: number;
+}
+
+export interface XpTransfer {
+    assetTransfer: string;
+    sender: string;
+    recipient: string;
+    recipientRS: string;
+    quantityQNT: string;
+}
+
+interface LeaderboardState {
+    tokenId: string;
+    holders: Map<string, XpHolder>;
+    excluded: Set<string>;
+    ranked: XpLeaderboardEntry[];
+    lastTransferId: string | null;
+    syncedAt: number;
+    refreshedAt: number;
+}
+
+const toStringArray = (csv: any = ""): Array<string> => csv.split(",").filter(Boolean);
+
+const ledger = LedgerClientFactory.createClient({
+    nodeHost: process.env.NEXT_PUBLIC_SIGNUM_DEFAULT_NODE || "",
+    reliableNodeHosts: toStringArray(process.env.NEXT_PUBLIC_SIGNUM_RELIABLE_NODES)
+})
+
+let state: LeaderboardState | null = null;
+let pendingRefresh: Promise<LeaderboardState | null> | null = null;
+
+// resolved names and contract accounts, kept across syncs
+const resolvedNames = new Map<string, string | null>();
+const contractAccounts = new Set<string>();
+const resolving = new Set<string>();
+
+/**
+ * Sorts holders by XP descending and assigns ranks.
+ * Only called on updates, so serving a page is a plain slice.
+ */
+export function rankHolders(holders: Iterable<XpHolder>): XpLeaderboardEntry[] {
+    return Array.from(holders)
+        .filter(h => h.xp > 0)
+        .sort((a, b) => b.xp - a.xp)
+        .map((h, idx) => ({
+            rank: idx + 1,
+            account: h.account,
+            accountRS: h.accountRS,
+            name: h.name,
+            xp: h.xp,
+        }));
+}
+
+/**
+ * Credits XP transfers sent by constructs to their recipients.
+ *
+ * @return Account ids that were not known as holders yet
+ */
+export function applyConstructTransfers(
+    holders: Map<string, XpHolder>,
+    transfers: XpTransfer[],
+    constructIds: Set<string>,
+    excluded: Set<string>,
+): string[] {
+    const newAccounts: string[] = [];
+    for (const transfer of transfers) {
+        if (!constructIds.has(transfer.sender) || excluded.has(transfer.recipient)) continue;
+
+        const xp = parseInt(transfer.quantityQNT || '0');
+        const holder = holders.get(transfer.recipient);
+        if (holder) {
+            holder.xp += xp;
+        } else {
+            holders.set(transfer.recipient, {
+                account: transfer.recipient,
+                accountRS: transfer.recipientRS,
+                name: null,
+                xp,
+            });
+            newAccounts.push(transfer.recipient);
+        }
+    }
+    return newAccounts;
+}
+
+export interface XpBalance {
+    accountRS: string;
+    xp: number;
+}
+
+/**
+ * Settles transfers that were confirmed while the holders were crawled. The crawled balances may or
+ * may not contain them, so the affected accounts get their re-read balances, and the newest of these
+ * transfers becomes the sync point - incremental syncs then never apply a transfer the crawl counted.
+ *
+ * @param transfers Transfers newer than the sync point taken before the crawl, newest first
+ * @param balances Re-read balances of the accounts involved in `transfers`
+ * @return The new sync point and the account ids that were not known as holders yet
+ */
+export function settleCrawlTransfers(
+    holders: Map<string, XpHolder>,
+    transfers: XpTransfer[],
+    balances: Map<string, XpBalance>,
+    excluded: Set<string>,
+    lastTransferId: string | null,
+): { lastTransferId: string | null, newAccounts: string[] } {
+    const newAccounts: string[] = [];
+    balances.forEach((balance, account) => {
+        if (excluded.has(account)) return;
+        const holder = holders.get(account);
+        if (balance.xp <= 0) {
+            holders.delete(account);
+        } else if (holder) {
+            holder.xp = balance.xp;
+        } else {
+            holders.set(account, {account, accountRS: balance.accountRS, name: null, xp: balance.xp});
+            newAccounts.push(account);
+        }
+    });
+    return {
+        lastTransferId: transfers.length > 0 ? transfers[0].assetTransfer : lastTransferId,
+        newAccounts,
+    };
+}
+
+/**
+ * Settles all transfers confirmed since `syncPoint` (see `settleCrawlTransfers`). Transfers confirmed while
+ * the balances are re-read may or may not be contained in them either, so transfers are fetched again after
+ * each round until no newer one shows up.
+ *
+ * @return The new sync point, or null if no clean sync point was found
+ */
+export async function settleTransfersSince(
+    holders: Map<string, XpHolder>,
+    excluded: Set<string>,
+    syncPoint: string | null,
+    fetchTransfers: (sinceTransferId: string | null) => Promise<XpTransfer[] | null>,
+    fetchBalances: (accountIds: string[]) => Promise<Map<string, XpBalance>>,
+): Promise<string | null> {
+    let lastTransferId = syncPoint;
+    for (let round = 0; round < MAX_SETTLE_ROUNDS; round++) {
+        const transfers = await fetchTransfers(lastTransferId);
+        if (!transfers) return null;
+        if (transfers.length === 0) return lastTransferId;
+
+        const involved = new Set<string>();
+        transfers.forEach(t => {
+            involved.add(t.sender);
+            involved.add(t.recipient);
+        });
+        const balances = await fetchBalances(Array.from(involved).filter(id => !excluded.has(id)));
+        lastTransferId = settleCrawlTransfers(holders, transfers, balances, excluded, lastTransferId).lastTransferId;
+    }
+    return null;
+}
+
+async function mapWithConcurrency<T, R>(items: T[], limit: number, fn: (item: T) => Promise<R>): Promise<R[]> {
+    const results = new Array<R>(items.length);
+    let next = 0;
+    const worker = async () => {
+        while (next < items.length) {
+            const i = next++;
+            results[i] = await fn(items[i]);
+        }
+    };
+    await Promise.all(Array.from({length: Math.min(limit, items.length)}, worker));
+    return results;
+}
+
+/**
+ * Fills in resolved names and drops holders that turned out to be contracts.
+ */
+function withResolvedNames(current: LeaderboardState): LeaderboardState {
+    const holders = new Map(current.holders);
+    const excluded = new Set(current.excluded);
+    let changed = false;
+    // holder records are shared with the current state, which may be serving requests
+    current.holders.forEach((holder, id) => {
+        if (contractAccounts.has(id)) {
+            holders.delete(id);
+            excluded.add(id);
+            changed = true;
+            return;
+        }
+        const name = resolvedNames.get(id);
+        if (name !== undefined && name !== holder.name) {
+            holders.set(id, {...holder, name});
+            changed = true;
+        }
+    });
+    return changed ? {...current, holders, excluded, ranked: rankHolders(holders.values())} : current;
+}
+
+function resolveInBackground(ledger: Ledger, accountIds: string[]) {
+    const unresolved = accountIds.filter(id => !resolvedNames.has(id) && !contractAccounts.has(id) && !resolving.has(id));
+    if (unresolved.length === 0) return;
+
+    unresolved.forEach(id => resolving.add(id));
+    mapWithConcurrency(unresolved, RESOLVE_CONCURRENCY, async id => {
+        const account = await resolveAccount(ledger, id);
+        if (!account) return;
+        if (account.isAT) {
+            contractAccounts.add(id);
+        } else {
+            resolvedNames.set(id, account.name ?? null);
+        }
+    })
+        .then(() => {
+            if (state) state = withResolvedNames(state);
+        })
+        .catch(e => console.error('xpLeaderboard name resolution failed:', e))
+        .finally(() => unresolved.forEach(id => resolving.delete(id)));
+}
+
+async function fetchLatestTransferId(ledger: Ledger, tokenId: string): Promise<string | null> {
+    const {transfers} = await ledger.asset.getAssetTransfers({assetId: tokenId, firstIndex: 0, lastIndex: 0});
+    return transfers?.[0]?.assetTransfer ?? null;
+}
+
+/**
+ * Collects transfers newer than `sinceTransferId` (newest first, as returned by the node).
+ * Without a `sinceTransferId`, all transfers are collected.
+ *
+ * @return The new transfers, or null if there are too many to be applied incrementally
+ */
+async function fetchTransfersSince(ledger: Ledger, tokenId: string, sinceTransferId: string | null): Promise<XpTransfer[] | null> {
+    const collected: XpTransfer[] = [];
+    for (let page = 0; page < MAX_TRANSFER_PAGES; page++) {
+        const firstIndex = page * TRANSFERS_PAGE_SIZE;
+        const {transfers = []} = await ledger.asset.getAssetTransfers({
+            assetId: tokenId,
+            firstIndex,
+            lastIndex: firstIndex + TRANSFERS_PAGE_SIZE - 1,
+        });
+        for (const transfer of transfers) {
+            if (transfer.assetTransfer === sinceTransferId) return collected;
+            collected.push(transfer);
+        }
+        if (transfers.length < TRANSFERS_PAGE_SIZE) return collected;
+    }
+    return null;
+}
+
+async function fetchXpBalances(ledger: Ledger, tokenId: string, accountIds: string[]): Promise<Map<string, XpBalance>> {
+    const accounts = await mapWithConcurrency(accountIds, RESOLVE_CONCURRENCY, accountId =>
+        ledger.account.getAccount({accountId})
+    );
+    const balances = new Map<string, XpBalance>();
+    accounts.forEach(account => {
+        const balance = account.assetBalances?.find(b => b.asset === tokenId);
+        balances.set(account.account, {accountRS: account.accountRS, xp: parseInt(balance?.balanceQNT || '0')});
+    });
+    return balances;
+}
+
+async function fullSync(ledger: Ledger, tokenId: string, previous: LeaderboardState | null): Promise<LeaderboardState> {
+    const [asset, crawlStartTransferId] = await Promise.all([
+        ledger.asset.getAsset({assetId: tokenId}),
+        fetchLatestTransferId(ledger, tokenId),
+    ]);
+
+    const excluded = getAllConstructIds();
+    excluded.add(asset.issuer);
+    previous?.excluded.forEach(id => excluded.add(id));
+    contractAccounts.forEach(id => excluded.add(id));
+
+    const holders = new Map<string, XpHolder>();
+    for (let firstIndex = 0; ; firstIndex += HOLDERS_PAGE_SIZE) {
+        const {accountAssets = []} = await ledger.asset.getAssetHolders({
+            assetId: tokenId,
+            ignoreTreasuryAccount: true,
+            firstIndex,
+            lastIndex: firstIndex + HOLDERS_PAGE_SIZE - 1,
+        });
+        for (const h of accountAssets) {
+            if (excluded.has(h.account)) continue;
+            holders.set(h.account, {
+                account: h.account,
+                accountRS: h.accountRS,
+                name: resolvedNames.get(h.account) ?? null,
+                xp: parseInt(h.quantityQNT || '0'),
+            });
+        }
+        if (accountAssets.length < HOLDERS_PAGE_SIZE) break;
+    }
+
+    // transfers confirmed during the crawl - without a clean sync point the next full sync starts over
+    const lastTransferId = await settleTransfersSince(
+        holders,
+        excluded,
+        crawlStartTransferId,
+        sinceTransferId => fetchTransfersSince(ledger, tokenId, sinceTransferId),
+        accountIds => fetchXpBalances(ledger, tokenId, accountIds),
+    );
+
+    resolveInBackground(ledger, Array.from(holders.keys()));
+
+    const now = Date.now();
+    return {
+        tokenId,
+        holders,
+        excluded,
+        ranked: rankHolders(holders.values()),
+        lastTransferId,
+        syncedAt: now,
+        refreshedAt: now,
+    };
+}
+
+async function incrementalSync(ledger: Ledger, current: LeaderboardState): Promise<LeaderboardState> {
+    if (!current.lastTransferId) return fullSync(ledger, current.tokenId, current);
+
+    const transfers = await fetchTransfersSince(ledger, current.tokenId, current.lastTransferId);
+    if (!transfers) return fullSync(ledger, current.tokenId, current);
+
+    if (transfers.length === 0) {
+        return {...current, refreshedAt: Date.now()};
+    }
+
+    const holders = new Map(current.holders);
+    // holder records are shared with the current state, which may be serving requests
+    for (const t of transfers) {
+        const holder = holders.get(t.recipient);
+        if (holder) holders.set(t.recipient, {...holder});
+    }
+    const excluded = new Set(current.excluded);
+    const newAccounts = applyConstructTransfers(holders, transfers, getAllConstructIds(), excluded);
+    resolveInBackground(ledger, newAccounts);
+
+    return {
+        ...current,
+        holders,
+        excluded,
+        ranked: rankHolders(holders.values()),
+        lastTransferId: transfers[0].assetTransfer,
+        refreshedAt: Date.now(),
+    };
+}
+
+async function refresh(tokenId: string): Promise<LeaderboardState | null> {
+    const now = Date.now();
+    // names resolved while syncing are applied before the result is published
+    if (!state || state.tokenId !== tokenId || now - state.syncedAt > FULL_SYNC_MS) {
+        state = withResolvedNames(await fullSync(ledger, tokenId, state?.tokenId === tokenId ? state : null));
+    } else if (now - state.refreshedAt > INCREMENTAL_REFRESH_MS) {
+        state = withResolvedNames(await incrementalSync(ledger, state));
+    }
+    return state;
+}
+
+async function getState(): Promise<LeaderboardState | null> {
+    const tokenId = getSignaRankTokenId();
+    if (!tokenId) return null;
+
+    const isFresh = state && state.tokenId === tokenId && Date.now() - state.refreshedAt <= INCREMENTAL_REFRESH_MS;
+    if (isFresh) return state;
+
+    if (!pendingRefresh) {
+        pendingRefresh = refresh(tokenId).finally(() => {
+            pendingRefresh = null;
+        });
+    }
+
+    // serve the previous ranking while an update is running, if there is one
+    if (state && state.tokenId === tokenId) {
+        pendingRefresh.catch(e => console.error('xpLeaderboard refresh failed:', e));
+        return state;
+    }
+    return pendingRefresh;
+}
+
+export async function getXpLeaderboardPage(offset: number, limit: number): Promise<XpLeaderboardPage> {
+    const current = await getState();
+    if (!current) {
+        return {entries: [], total: 0, updatedAt: 0};
+    }
+
+    const start = Math.max(0, offset);
+    const end = start + Math.min(Math.max(0, limit), MAX_PAGE_SIZE);
+    return {
+        entries: current.ranked.slice(start, end),
+        total: current.ranked.length,
+        updatedAt: current.refreshedAt,
+    };
+}
@@ -0,0 +1,7 @@
+/**
+ * IPFS configuration, shared by server and browser code.
+ *
+ * The gateway can be configured via NEXT_PUBLIC_IPFS_GATEWAY environment variable.
+ */
+
+export const IPFS_GATEWAY = process.env.NEXT_PUBLIC_IPFS_GATEWAY || "https://ipfs.io/ipfs";
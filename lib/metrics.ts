@@ -0,0 +1,312 @@
+/**
+ * Lightweight latency and cache metrics
+ *
+ * In-process registry of histograms and counters, rendered in the Prometheus text format
+ * by /api/admin/metrics. Metrics live per server instance and start empty on each cold start.
+ *
+ * In the browser, the same functions record into a local registry that is periodically
+ * reported to /api/metrics/client, so construct hook timings and ConstructCache hit rates
+ * of real visitors show up next to the server metrics. Reports are unauthenticated, so they
+ * are kept apart from the server's own series: separate `signarank_client_*` metrics,
+ * a fixed set of label values and their own series cap.
+ */
+
+import {isClientSide} from './isClientSide';
+
+export type Labels = Record<string, string>;
+
+export const Metrics = {
+    ScorePhase: 'signarank_score_phase_duration_seconds',
+    NodeCall: 'signarank_node_call_duration_seconds',
+    ServiceCall: 'signarank_service_call_duration_seconds',
+    DbQuery: 'signarank_db_query_duration_seconds',
+    CacheLookups: 'signarank_cache_lookups_total',
+    // recorded in browsers and reported by clients
+    ConstructHook: 'signarank_client_construct_hook_duration_seconds',
+    ClientCacheLookups: 'signarank_client_cache_lookups_total',
+} as const;
+
+const Help: Record<string, string> = {
+    [Metrics.ScorePhase]: 'Duration of the phases of a score calculation',
+    [Metrics.NodeCall]: 'Duration of Signum node API calls',
+    [Metrics.ServiceCall]: 'Duration of external service API calls',
+    [Metrics.DbQuery]: 'Duration of database queries',
+    [Metrics.CacheLookups]: 'Cache lookups by result',
+    [Metrics.ConstructHook]: 'Duration of construct data hook fetches, reported by clients',
+    [Metrics.ClientCacheLookups]: 'Browser cache lookups by result, reported by clients',
+};
+
+export const ConstructHooks = [
+    'useConstruct',
+    'useAttackHistory',
+    'useAttackerData',
+    'useConstructRanking',
+    'usePendingAttacks',
+    'usePlayerConstructStats',
+    'useTokenBalances',
+    'useUserCooldown',
+] as const;
+export type ConstructHook = typeof ConstructHooks[number];
+
+export const ClientCaches = ['construct_token_meta', 'construct_meta', 'resolve_account'] as const;
+
+/** Accepted label values of client reports, per metric and label */
+const ClientLabelValues: Record<string, Record<string, ReadonlyArray<string>>> = {
+    [Metrics.ConstructHook]: {hook: ConstructHooks},
+    [Metrics.ClientCacheLookups]: {cache: ClientCaches, result: ['hit', 'miss']},
+};
+
+// seconds - node calls and the score loop range from a few ms to several seconds
+export const BUCKETS = [0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10, 30];
+
+const MAX_SERIES = 500;
+const MAX_CLIENT_SERIES = 50;
+const CLIENT_REPORT_INTERVAL_MS = 60 * 1000;
+
+interface HistogramSeries {
+    name: string;
+    labels: Labels;
+    buckets: number[];
+    sum: number;
+    count: number;
+}
+
+interface CounterSeries {
+    name: string;
+    labels: Labels;
+    value: number;
+}
+
+export interface MetricsSnapshot {
+    histograms: HistogramSeries[];
+    counters: CounterSeries[];
+}
+
+interface Registry {
+    histograms: Map<string, HistogramSeries>;
+    counters: Map<string, CounterSeries>;
+    maxSeries: number;
+}
+
+const createRegistry = (maxSeries: number): Registry => ({histograms: new Map(), counters: new Map(), maxSeries});
+
+// own series of this process (in the browser: not yet reported ones)
+let local = createRegistry(MAX_SERIES);
+// series merged from client reports
+let reported = createRegistry(MAX_CLIENT_SERIES);
+
+const seriesKey = (name: string, labels: Labels) =>
+    name + JSON.stringify(Object.keys(labels).sort().map(k => [k, labels[k]]));
+
+function getHistogram(registry: Registry, name: string, labels: Labels): HistogramSeries | null {
+    const key = seriesKey(name, labels);
+    let series = registry.histograms.get(key);
+    if (!series) {
+        if (registry.histograms.size >= registry.maxSeries) return null;
+        series = {name, labels, buckets: new Array(BUCKETS.length).fill(0), sum: 0, count: 0};
+        registry.histograms.set(key, series);
+    }
+    return series;
+}
+
+function getCounter(registry: Registry, name: string, labels: Labels): CounterSeries | null {
+    const key = seriesKey(name, labels);
+    let series = registry.counters.get(key);
+    if (!series) {
+        if (registry.counters.size >= registry.maxSeries) return null;
+        series = {name, labels, value: 0};
+        registry.counters.set(key, series);
+    }
+    return series;
+}
+
+export function observe(name: string, labels: Labels, seconds: number) {
+    const series = getHistogram(local, name, labels);
+    if (!series) return;
+    // buckets are stored non-cumulative and summed up when rendering
+    const idx = BUCKETS.findIndex(le => seconds <= le);
+    if (idx >= 0) series.buckets[idx]++;
+    series.sum += seconds;
+    series.count++;
+    scheduleClientReport();
+}
+
+export function increment(name: string, labels: Labels, value = 1) {
+    const series = getCounter(local, name, labels);
+    if (!series) return;
+    series.value += value;
+    scheduleClientReport();
+}
+
+export function countCacheLookup(cache: string, hit: boolean) {
+    increment(isClientSide() ? Metrics.ClientCacheLookups : Metrics.CacheLookups, {cache, result: hit ? 'hit' : 'miss'});
+}
+
+/**
+ * Starts a span - call the returned function when done.
+ */
+export function startTimer(name: string, labels: Labels): () => number {
+    const start = performance.now();
+    return () => {
+        const seconds = (performance.now() - start) / 1000;
+        observe(name, labels, seconds);
+        return seconds;
+    };
+}
+
+/**
+ * Times an async call, including failed ones.
+ */
+export async function timed<T>(name: string, labels: Labels, fn: () => Promise<T>): Promise<T> {
+    const end = startTimer(name, labels);
+    try {
+        return await fn();
+    } finally {
+        end();
+    }
+}
+
+export const timeNodeCall = <T>(method: string, fn: () => Promise<T>) => timed(Metrics.NodeCall, {method}, fn);
+export const timeServiceCall = <T>(service: string, method: string, fn: () => Promise<T>) => timed(Metrics.ServiceCall, {service, method}, fn);
+export const timeDbQuery = <T>(query: string, fn: () => Promise<T>) => timed(Metrics.DbQuery, {query}, fn);
+export const timeConstructHook = <T>(hook: ConstructHook, fn: () => Promise<T>) => timed(Metrics.ConstructHook, {hook}, fn);
+
+function snapshotOf(registry: Registry): MetricsSnapshot {
+    return {
+        histograms: Array.from(registry.histograms.values()),
+        counters: Array.from(registry.counters.values()),
+    };
+}
+
+/**
+ * Returns the own series of this process - with `reset`, they start over.
+ */
+export function takeSnapshot(reset = false): MetricsSnapshot {
+    const snapshot = snapshotOf(local);
+    if (reset) {
+        local = createRegistry(MAX_SERIES);
+    }
+    return snapshot;
+}
+
+export function resetMetrics() {
+    local = createRegistry(MAX_SERIES);
+    reported = createRegistry(MAX_CLIENT_SERIES);
+}
+
+function isAllowedClientSeries(name: unknown, labels: unknown): labels is Labels {
+    const allowed = typeof name === 'string' ? ClientLabelValues[name] : undefined;
+    if (!allowed || !labels || typeof labels !== 'object') return false;
+    const keys = Object.keys(labels);
+    return keys.length === Object.keys(allowed).length &&
+        keys.every(k => allowed[k]?.includes((labels as any)[k]));
+}
+
+const isCount = (n: unknown): n is number => typeof n === 'number' && Number.isFinite(n) && n >= 0;
+
+/**
+ * Merges a snapshot reported by a client into the client metrics.
+ * Only known client metrics with known label values are accepted, everything else is dropped.
+ *
+ * @return Number of merged series
+ */
+export function mergeClientSnapshot(snapshot: Partial<MetricsSnapshot>): number {
+    let merged = 0;
+    for (const h of snapshot.histograms ?? []) {
+        if (h?.name !== Metrics.ConstructHook || !isAllowedClientSeries(h.name, h.labels)) continue;
+        if (!isCount(h.sum) || !isCount(h.count)) continue;
+        if (!Array.isArray(h.buckets) || h.buckets.length !== BUCKETS.length || !h.buckets.every(isCount)) continue;
+        const series = getHistogram(reported, h.name, h.labels);
+        if (!series) continue;
+        h.buckets.forEach((n, i) => series.buckets[i] += n);
+        series.sum += h.sum;
+        series.count += h.count;
+        merged++;
+    }
+    for (const c of snapshot.counters ?? []) {
+        if (c?.name !== Metrics.ClientCacheLookups || !isAllowedClientSeries(c.name, c.labels) || !isCount(c.value)) continue;
+        const series = getCounter(reported, c.name, c.labels);
+        if (!series) continue;
+        series.value += c.value;
+        merged++;
+    }
+    return merged;
+}
+
+const escapeLabelValue = (v: string) => v.replace(/\\/g, '\\\\').replace(/"/g, '\\"').replace(/\n/g, '\\n');
+
+function formatLabels(labels: Labels, extra?: Labels): string {
+    const all = {...labels, ...extra};
+    const parts = Object.keys(all).map(k => `${k}="${escapeLabelValue(all[k])}"`);
+    return parts.length ? `{${parts.join(',')}}` : '';
+}
+
+function groupByName<T extends { name: string }>(series: T[]): Map<string, T[]> {
+    const groups = new Map<string, T[]>();
+    series.forEach(s => {
+        const group = groups.get(s.name);
+        if (group) group.push(s);
+        else groups.set(s.name, [s]);
+    });
+    return groups;
+}
+
+/**
+ * Renders all metrics in the Prometheus text exposition format (0.0.4).
+ */
+export function renderPrometheus(): string {
+    const lines: string[] = [];
+    const own = snapshotOf(local);
+    const clients = snapshotOf(reported);
+    const histograms = own.histograms.concat(clients.histograms);
+    const counters = own.counters.concat(clients.counters);
+
+    groupByName(histograms).forEach((group, name) => {
+        lines.push(`# HELP ${name} ${Help[name] ?? name}`, `# TYPE ${name} histogram`);
+        group.forEach(({labels, buckets, sum, count}) => {
+            let cumulative = 0;
+            BUCKETS.forEach((le, i) => {
+                cumulative += buckets[i];
+                lines.push(`${name}_bucket${formatLabels(labels, {le: String(le)})} ${cumulative}`);
+            });
+            lines.push(`${name}_bucket${formatLabels(labels, {le: '+Inf'})} ${count}`);
+            lines.push(`${name}_sum${formatLabels(labels)} ${sum}`);
+            lines.push(`${name}_count${formatLabels(labels)} ${count}`);
+        });
+    });
+
+    groupByName(counters).forEach((group, name) => {
+        lines.push(`# HELP ${name} ${Help[name] ?? name}`, `# TYPE ${name} counter`);
+        group.forEach(({labels, value}) => lines.push(`${name}${formatLabels(labels)} ${value}`));
+    });
+
+    return lines.join('\n') + '\n';
+}
+
+let reportTimer: ReturnType<typeof setTimeout> | null = null;
+
+function reportClientMetrics() {
+    reportTimer = null;
+    const snapshot = takeSnapshot(true);
+    if (!snapshot.histograms.length && !snapshot.counters.length) return;
+    const body = JSON.stringify(snapshot);
+    if (navigator.sendBeacon?.('/api/metrics/client', new Blob([body], {type: 'application/json'}))) return;
+    fetch('/api/metrics/client', {method: 'POST', headers: {'Content-Type': 'application/json'}, body, keepalive: true})
+        .catch(() => {
+            // metrics are best-effort
+        });
+}
+
+function scheduleClientReport() {
+    if (!isClientSide() || reportTimer) return;
+    reportTimer = setTimeout(reportClientMetrics, CLIENT_REPORT_INTERVAL_MS);
+}
+
+if (isClientSide()) {
+    window.addEventListener('pagehide', () => {
+        if (reportTimer) {
+            clearTimeout(reportTimer);
+            reportClientMetrics();
+        }
+    });
+}
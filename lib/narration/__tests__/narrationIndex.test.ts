@@ -0,0 +1,57 @@
+import { describe, it, expect, vi, afterEach } from 'vitest';
+import { buildNarrationIndex, pickFromIndex } from '../narrationIndex';
+import { pickNarration, type Narration } from '../pickNarration';
+
+function makeNarration(id: number, tags: string[]): Narration {
+    return { id, text: `Narration ${id}`, tags };
+}
+
+afterEach(() => {
+    vi.restoreAllMocks();
+});
+
+describe('pickFromIndex', () => {
+    it('returns null for an empty set', () => {
+        expect(pickFromIndex(buildNarrationIndex([]), ['whale'])).toBeNull();
+    });
+
+    it('returns the best match by intersection size', () => {
+        const index = buildNarrationIndex([
+            makeNarration(1, ['whale', 'fresh', 'full_health', 'safe_attack', 'no_token']),
+            makeNarration(2, ['whale', 'debuffed']),
+            makeNarration(3, ['pocket_change']),
+        ]);
+        expect(pickFromIndex(index, ['whale', 'fresh', 'full_health'])?.id).toBe(1);
+    });
+
+    it('falls back to all narrations when no tags overlap', () => {
+        const index = buildNarrationIndex([makeNarration(1, ['fresh']), makeNarration(2, ['debuffed'])]);
+        vi.spyOn(Math, 'random').mockReturnValue(0.99);
+        expect(pickFromIndex(index, ['whale'])?.id).toBe(2);
+    });
+
+    it('handles more tags than fit in one mask word', () => {
+        const tags = Array.from({ length: 70 }, (_, i) => `tag_${i}`);
+        const index = buildNarrationIndex([
+            makeNarration(1, tags.slice(0, 40)),
+            makeNarration(2, tags.slice(30, 70)),
+        ]);
+        expect(pickFromIndex(index, tags.slice(50, 70))?.id).toBe(2);
+        expect(pickFromIndex(index, tags.slice(0, 35))?.id).toBe(1);
+    });
+
+    it('picks the same narration as a linear scan for the same random draw', () => {
+        const pool = ['whale', 'fresh', 'debuffed', 'full_health', 'pocket_change', 'no_token', 'final_blow'];
+        const narrations = Array.from({ length: 200 }, (_, i) =>
+            makeNarration(i, pool.filter((_, t) => (i * 7 + t * 13) % 5 < 2))
+        );
+        const index = buildNarrationIndex(narrations);
+
+        for (let draw = 0; draw < 50; draw++) {
+            const desired = pool.filter((_, t) => (draw + t) % 3 === 0);
+            const random = (draw * 0.0197) % 1;
+            vi.spyOn(Math, 'random').mockReturnValue(random);
+            expect(pickFromIndex(index, desired)?.id).toBe(pickNarration(narrations, desired)?.id);
+        }
+    });
+});
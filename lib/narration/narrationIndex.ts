@@ -0,0 +1,107 @@
+import type { Narration } from './pickNarration';
+
+/**
+ * Tag index over a fixed narration set.
+ *
+ * Every distinct tag gets a bit; each narration stores the bitmask of its tags, and each tag
+ * keeps the list of narrations carrying it. A pick only visits narrations sharing at least one
+ * desired tag and scores them by popcount(narration mask & desired mask).
+ *
+ * Picks give the same result as `pickNarration` over the same narrations (tags of a narration
+ * are counted once), including the uniform random choice among the best candidates.
+ */
+export interface NarrationIndex {
+    narrations: Narration[];
+    tagBits: Map<string, number>;
+    /** narration indices per tag bit, ascending */
+    postings: Int32Array[];
+    /** `words` 32-bit words per narration */
+    masks: Uint32Array;
+    words: number;
+}
+
+function popcount(x: number): number {
+    x = x - ((x >>> 1) & 0x55555555);
+    x = (x & 0x33333333) + ((x >>> 2) & 0x33333333);
+    return Math.imul((x + (x >>> 4)) & 0x0f0f0f0f, 0x01010101) >>> 24;
+}
+
+export function buildNarrationIndex(narrations: Narration[]): NarrationIndex {
+    const tagBits = new Map<string, number>();
+    const postingLists: number[][] = [];
+
+    narrations.forEach((narration, idx) => {
+        new Set(narration.tags).forEach(tag => {
+            let bit = tagBits.get(tag);
+            if (bit === undefined) {
+                bit = postingLists.length;
+                tagBits.set(tag, bit);
+                postingLists.push([]);
+            }
+            postingLists[bit].push(idx);
+        });
+    });
+
+    const words = Math.max(1, Math.ceil(tagBits.size / 32));
+    const masks = new Uint32Array(narrations.length * words);
+    postingLists.forEach((list, bit) => {
+        const word = bit >>> 5;
+        const flag = 1 << (bit & 31);
+        for (const idx of list) masks[idx * words + word] |= flag;
+    });
+
+    return {
+        narrations,
+        tagBits,
+        postings: postingLists.map(list => Int32Array.from(list)),
+        masks,
+        words,
+    };
+}
+
+export function pickFromIndex(index: NarrationIndex, desiredTags: string[]): Narration | null {
+    const { narrations, tagBits, postings, masks, words } = index;
+    if (narrations.length === 0) return null;
+
+    const desired = new Uint32Array(words);
+    const bits: number[] = [];
+    new Set(desiredTags).forEach(tag => {
+        const bit = tagBits.get(tag);
+        if (bit === undefined) return;
+        desired[bit >>> 5] |= 1 << (bit & 31);
+        bits.push(bit);
+    });
+
+    // no narration shares a tag - all tie at 0
+    if (bits.length === 0) {
+        return narrations[Math.floor(Math.random() * narrations.length)];
+    }
+
+    const visited = new Uint8Array(narrations.length);
+    let bestScore = 0;
+    let bestCandidates: number[] = [];
+
+    for (const bit of bits) {
+        const list = postings[bit];
+        for (let i = 0; i < list.length; i++) {
+            const idx = list[i];
+            if (visited[idx]) continue;
+            visited[idx] = 1;
+
+            let score = 0;
+            const offset = idx * words;
+            for (let w = 0; w < words; w++) score += popcount(masks[offset + w] & desired[w]);
+
+            if (score > bestScore) {
+                bestScore = score;
+                bestCandidates = [idx];
+            } else if (score === bestScore) {
+                bestCandidates.push(idx);
+            }
+        }
+    }
+
+    // keep the candidate order of a linear scan, so the random choice is identical
+    bestCandidates.sort((a, b) => a - b);
+    return narrations[bestCandidates[Math.floor(Math.random() * bestCandidates.length)]];
+}
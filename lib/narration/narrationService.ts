@@ -0,0 +1,100 @@
+/**
+ * Narration service
+ *
+ * Keeps an indexed copy of the narrations per season, construct and locale in memory,
+ * so picks are answered without a database round trip.
+ *
+ * - The first pick for a set loads it; later picks are served from the index
+ * - Every minute, a pick triggers a background version check (count + max id) and
+ *   the set is reloaded when narrations were added or removed
+ * - Edited narrations are picked up by the periodic full reload
+ *
+ * Season, construct and locale come from a public endpoint, so the number of cached sets
+ * and of concurrent loads is capped.
+ */
+
+import { CACHE_TTL_MS } from '@lib/cacheConfig';
+import type { Narration } from './pickNarration';
+import { buildNarrationIndex, NarrationIndex, pickFromIndex } from './narrationIndex';
+import { getNarrationSetVersion, loadNarrations, NarrationSetKey } from './repository';
+
+const VERSION_CHECK_MS = 60 * 1000;
+const FULL_RELOAD_MS = CACHE_TTL_MS;
+const MAX_ENTRIES = 500;
+const MAX_PENDING = 50;
+
+interface IndexEntry {
+    index: NarrationIndex;
+    version: string;
+    loadedAt: number;
+    checkedAt: number;
+}
+
+const entries = new Map<string, IndexEntry>();
+const pending = new Map<string, Promise<IndexEntry>>();
+
+const cacheKey = ({ seasonName, constructName, locale }: NarrationSetKey) =>
+    `${seasonName}\u0000${constructName}\u0000${locale}`;
+
+async function load(key: NarrationSetKey): Promise<IndexEntry> {
+    // version first: rows added in between only cause one extra reload
+    const version = await getNarrationSetVersion(key);
+    const narrations = await loadNarrations(key);
+    const now = Date.now();
+    return { index: buildNarrationIndex(narrations), version, loadedAt: now, checkedAt: now };
+}
+
+async function revalidate(key: NarrationSetKey, entry: IndexEntry): Promise<IndexEntry> {
+    const version = await getNarrationSetVersion(key);
+    const now = Date.now();
+    if (version !== entry.version || now - entry.loadedAt > FULL_RELOAD_MS) {
+        return load(key);
+    }
+    return { ...entry, checkedAt: now };
+}
+
+function store(k: string, entry: IndexEntry) {
+    entries.delete(k);
+    if (entries.size >= MAX_ENTRIES) {
+        // maps iterate in insertion order - drop the oldest entry
+        entries.delete(entries.keys().next().value as string);
+    }
+    entries.set(k, entry);
+}
+
+function schedule(k: string, task: () => Promise<IndexEntry>): Promise<IndexEntry> {
+    let promise = pending.get(k);
+    if (!promise) {
+        promise = task()
+            .then(entry => {
+                store(k, entry);
+                return entry;
+            })
+            .finally(() => pending.delete(k));
+        pending.set(k, promise);
+    }
+    return promise;
+}
+
+async function getIndex(key: NarrationSetKey): Promise<NarrationIndex | null> {
+    const k = cacheKey(key);
+    const entry = entries.get(k);
+    if (!entry) {
+        if (!pending.has(k) && pending.size >= MAX_PENDING) {
+            // too many sets loading at once - no narration this time
+            return null;
+        }
+        return (await schedule(k, () => load(key))).index;
+    }
+
+    if (Date.now() - entry.checkedAt > VERSION_CHECK_MS && !pending.has(k) && pending.size < MAX_PENDING) {
+        schedule(k, () => revalidate(key, entry))
+            .catch(e => console.error('narration refresh failed:', e));
+    }
+    return entry.index;
+}
+
+export async function pickIndexedNarration(key: NarrationSetKey, tags: string[]): Promise<Narration | null> {
+    const index = await getIndex(key);
+    return index ? pickFromIndex(index, tags) : null;
+}
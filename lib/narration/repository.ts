@@ -2,25 +2,28 @@ import { prisma } from '@lib/prisma';
 
 const BASE_SELECT = { id: true, text: true, tags: true } as const;
 
-export async function findNarrations(params: {
+export interface NarrationSetKey {
     seasonName: string;
     constructName: string;
     locale: string;
-    tags: string[];
-}) {
-    const { seasonName, constructName, locale, tags } = params;
-    const base = { seasonName, constructName, locale };
-
-    if (tags.length > 0) {
-        const matches = await prisma.attackNarration.findMany({
-            where: { ...base, tags: { hasSome: tags } },
-            select: BASE_SELECT,
-        });
-        if (matches.length > 0) return matches;
-    }
+}
 
+export async function loadNarrations(key: NarrationSetKey) {
     return prisma.attackNarration.findMany({
-        where: base,
+        where: key,
         select: BASE_SELECT,
+        orderBy: { id: 'asc' },
+    });
+}
+
+/**
+ * Cheap fingerprint of a narration set - changes when narrations are added or removed.
+ */
+export async function getNarrationSetVersion(key: NarrationSetKey): Promise<string> {
+    const { _count, _max } = await prisma.attackNarration.aggregate({
+        where: key,
+        _count: { _all: true },
+        _max: { id: true },
     });
+    return `${_count._all}:${_max.id ?? 0}`;
 }
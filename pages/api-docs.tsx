@@ -44,6 +44,30 @@ const APIDocs = () => {
         },
         ...
     ]
+}`}
+        </pre>
+        <hr style={{margin: '2rem 0', borderColor: 'darkgray'}}/>
+        <h4>Get XP Leaderboard </h4>
+        <p>Returns the XP hunters ranked by XP token balance in JSON format. Use <code>offset</code> and <code>limit</code> (max 100) to page through the ranking.</p>
+        <pre>
+            {hostName}{`/api/leaderboard/xp?offset=0&limit=50`}
+        </pre>
+        <p>Try this endpoint in your <a href="api/leaderboard/xp" rel="noreferrer noopener" target="_blank">browser 🔗</a>.</p>
+        <h5>Sample Response</h5>
+        <pre>
+            {`{
+    "entries": [
+        {
+            "rank": 1,
+            "account": "2402520554221019656",
+            "accountRS": "S-9K9L-4CB5-88Y5-F5G4Z",
+            "name": "Hunter",
+            "xp": 1250
+        },
+        ...
+    ],
+    "total": 312,
+    "updatedAt": 1760000000000
 }`}
         </pre>
 
@@ -0,0 +1,28 @@
+import type {NextApiRequest, NextApiResponse} from 'next'
+import {verifyAdminAuth} from '@lib/adminAuth';
+import {renderPrometheus} from '@lib/metrics';
+
+/**
+ * Exposes latency histograms and cache counters in the Prometheus text format.
+ *
+ * Metrics are kept per server instance since its start, so scrape each instance
+ * (or aggregate the counters) rather than expecting a global view.
+ *
+ * IMPORTANT: Requires authentication (CRON_SECRET or NEXT_SERVER_ADMIN_SECRET).
+ */
+export default function handler(
+    req: NextApiRequest,
+    res: NextApiResponse
+) {
+    if (req.method !== 'GET') {
+        return res.status(405).end();
+    }
+
+    if (!verifyAdminAuth(req, res)) {
+        return; // Response already sent by verifyAdminAuth
+    }
+
+    res.setHeader('Content-Type', 'text/plain; version=0.0.4; charset=utf-8');
+    res.setHeader('Cache-Control', 'no-store');
+    res.status(200).send(renderPrometheus());
+}
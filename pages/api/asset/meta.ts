@@ -0,0 +1,32 @@
+import type { NextApiRequest, NextApiResponse } from 'next';
+import { addCacheHeader } from '@lib/addCacheHeader';
+import { getTokenMetas } from '@lib/construct/tokenMetaStore';
+import { MAX_TOKEN_META_BATCH } from '@lib/construct/tokenMeta';
+
+const TOKEN_ID_PATTERN = /^\d{1,20}$/;
+
+export default async function handler(req: NextApiRequest, res: NextApiResponse) {
+    if (req.method !== 'GET') {
+        return res.status(405).end();
+    }
+
+    const { ids } = req.query;
+    if (!ids || typeof ids !== 'string') {
+        return res.status(400).json({ error: 'Missing ids param' });
+    }
+
+    const tokenIds = Array.from(new Set(ids.split(',').filter(Boolean)));
+    if (tokenIds.length === 0 || tokenIds.length > MAX_TOKEN_META_BATCH || !tokenIds.every(id => TOKEN_ID_PATTERN.test(id))) {
+        return res.status(400).json({ error: `Expected 1 to ${MAX_TOKEN_META_BATCH} comma separated token ids` });
+    }
+
+    try {
+        const tokens = await getTokenMetas(tokenIds);
+        // incomplete results only as long as the store remembers the failed ids
+        addCacheHeader(res, tokens.length === tokenIds.length ? 60 : 5);
+        return res.status(200).json({ tokens });
+    } catch (err) {
+        console.error('Token metadata error:', err);
+        return res.status(500).json({ error: 'Failed to load token metadata' });
+    }
+}
@@ -0,0 +1,31 @@
+import type {NextApiRequest, NextApiResponse} from 'next'
+import {boomify} from '@hapi/boom';
+import {getXpLeaderboardPage, MAX_PAGE_SIZE} from '@lib/construct/xpLeaderboard';
+import {singleQueryString} from '@lib/singleQueryString';
+import {addCacheHeader} from '@lib/addCacheHeader';
+
+const DEFAULT_PAGE_SIZE = 50;
+
+export default async function handler(
+    req: NextApiRequest,
+    res: NextApiResponse
+) {
+    if (req.method !== 'GET') {
+        return res.status(405).end();
+    }
+
+    const offset = parseInt(singleQueryString(req.query.offset) || '0', 10);
+    const limit = parseInt(singleQueryString(req.query.limit) || `${DEFAULT_PAGE_SIZE}`, 10);
+    if (isNaN(offset) || isNaN(limit) || offset < 0 || limit < 1 || limit > MAX_PAGE_SIZE) {
+        return res.status(400).json({error: `Invalid offset or limit (max ${MAX_PAGE_SIZE})`});
+    }
+
+    try {
+        const page = await getXpLeaderboardPage(offset, limit);
+        addCacheHeader(res, 1)
+        res.status(200).json(page)
+    } catch (e: any) {
+        const boom = boomify(e)
+        res.status(400).json(boom.output.payload)
+    }
+}
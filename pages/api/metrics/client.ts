@@ -0,0 +1,33 @@
+import type {NextApiRequest, NextApiResponse} from 'next'
+import {mergeClientSnapshot} from '@lib/metrics';
+
+const MAX_BODY_LENGTH = 64 * 1024;
+
+/**
+ * Receives construct hook timings and cache counters reported by browsers.
+ * Kept apart from the server metrics, only known metrics and label values are merged - see `mergeClientSnapshot`.
+ */
+export default function handler(
+    req: NextApiRequest,
+    res: NextApiResponse
+) {
+    if (req.method !== 'POST') {
+        return res.status(405).end();
+    }
+
+    try {
+        // sendBeacon may not set a JSON content type
+        const raw = typeof req.body === 'string' ? req.body : JSON.stringify(req.body ?? {});
+        if (raw.length > MAX_BODY_LENGTH) {
+            return res.status(413).end();
+        }
+        const snapshot = JSON.parse(raw);
+        mergeClientSnapshot({
+            histograms: Array.isArray(snapshot?.histograms) ? snapshot.histograms : [],
+            counters: Array.isArray(snapshot?.counters) ? snapshot.counters : [],
+        });
+        res.status(204).end();
+    } catch {
+        res.status(400).end();
+    }
+}
@@ -1,6 +1,5 @@
 import type { NextApiRequest, NextApiResponse } from 'next';
-import { findNarrations } from '@lib/narration/repository';
-import { pickNarration } from '@lib/narration/pickNarration';
+import { pickIndexedNarration } from '@lib/narration/narrationService';
 
 export default async function handler(req: NextApiRequest, res: NextApiResponse) {
     if (req.method !== 'GET') {
@@ -21,8 +20,7 @@ export default async function handler(req: NextApiRequest, res: NextApiResponse)
     const parsedTags = tags ? tags.split(',').filter(Boolean) : [];
 
     try {
-        const candidates = await findNarrations({ seasonName, constructName, locale, tags: parsedTags });
-        const picked = pickNarration(candidates, parsedTags);
+        const picked = await pickIndexedNarration({ seasonName, constructName, locale }, parsedTags);
 
         if (!picked) {
             return res.status(204).end();
@@ -15,22 +15,23 @@ import {ExceptionInactiveAccount} from './exceptionInactiveAccount';
 import {Amount} from '@signumjs/util';
 import {NftService} from './nftService';
 import {getCategoryScoresFromProgress, getTitle, getTier, Tier} from '@lib/titles';
+import {countCacheLookup, Metrics, startTimer, timed, timeDbQuery, timeNodeCall, timeServiceCall} from '@lib/metrics';
 
 async function calculateRankAndTotal(score: number): Promise<{ rank: number; total: number }> {
-    const result = await prisma.$queryRaw<Array<{ rank: number; total: number }>>`
+    const result = await timeDbQuery('address_rank', () => prisma.$queryRaw<Array<{ rank: number; total: number }>>`
         SELECT
             ((SELECT COUNT(*) FROM "Address" WHERE score > ${score} AND active = true) + 1)::int AS rank,
             (SELECT COUNT(*) FROM "Address" WHERE active = true)::int AS total
-    `;
+    `);
     return result[0];
 }
 
 async function fetchCachedAddress(accountId: string) {
-    const cacheAddress = await prisma.address.findFirst({
+    const cacheAddress = await timeDbQuery('address_find', () => prisma.address.findFirst({
         where: {
             address: accountId
         }
-    });
+    }));
 
     if (cacheAddress && !cacheAddress.active) {
         throw new ExceptionInactiveAccount(accountId)
@@ -40,6 +41,7 @@ async function fetchCachedAddress(accountId: string) {
     const cacheHit = cacheAddress &&
                      cacheAddress.updatedAt > new Date(Date.now() - CACHE_TTL_MS) &&
                      !IS_DEVELOPMENT;
+    countCacheLookup('score_address', !!cacheHit);
 
     return {
         cacheAddress,
@@ -84,12 +86,12 @@ const nftService = (process.env.NEXT_SERVER_NFT_SERVICE_API_HOST && process.env.
 
 async function hasDonatedToSNA(ledger:Ledger, accountId: string){
     const SNAAccount = "8952122635653861124"
-    const txs = await ledger.service.query<TransactionList>('getAccountTransactions', {
+    const txs = await timeNodeCall('getAccountTransactions_sna', () => ledger.service.query<TransactionList>('getAccountTransactions', {
         sender: accountId,
         recipient: SNAAccount,
         includeIndirect: false,
         bidirectional: false,
-    })
+    }))
     return txs.transactions.reduce( (sum, tx) => {
         try{
             const amount = Amount.fromPlanck(tx.amountNQT);
@@ -131,6 +133,7 @@ export async function calculateScore(accountId: string) {
     let cached = false;
     let error = false;
     let name = '';
+    const endTotal = startTimer(Metrics.ScorePhase, {phase: 'total'});
     try {
 
         assertValidAccountAddress(accountId);
@@ -150,18 +153,18 @@ export async function calculateScore(accountId: string) {
 
             // Fetch NFT count only if NFT service is configured
             const nftCountPromise = nftService
-                ? nftService.getNftCountPerAccount(accountId)
+                ? timeServiceCall('nft', 'getNftCountPerAccount', () => nftService.getNftCountPerAccount(accountId))
                 : Promise.resolve(0);
 
-            const [transactionList, blockList, account, accountAliases, contracts, nftCount, blockchainStatus] = await Promise.all([
-                ledger.account.getAccountTransactions({accountId, includeIndirect: false}),
-                ledger.account.getAccountBlocks({accountId, includeTransactions: false}),
-                ledger.account.getAccount({accountId, includeCommittedAmount: true}),
-                ledger.alias.getAliases({accountId}),
-                ledger.contract.getContractsByAccount({accountId}),
+            const [transactionList, blockList, account, accountAliases, contracts, nftCount, blockchainStatus] = await timed(Metrics.ScorePhase, {phase: 'ledger_fetch'}, () => Promise.all([
+                timeNodeCall('getAccountTransactions', () => ledger.account.getAccountTransactions({accountId, includeIndirect: false})),
+                timeNodeCall('getAccountBlocks', () => ledger.account.getAccountBlocks({accountId, includeTransactions: false})),
+                timeNodeCall('getAccount', () => ledger.account.getAccount({accountId, includeCommittedAmount: true})),
+                timeNodeCall('getAliases', () => ledger.alias.getAliases({accountId})),
+                timeNodeCall('getContractsByAccount', () => ledger.contract.getContractsByAccount({accountId})),
                 nftCountPromise,
-                ledger.network.getBlockchainStatus()
-            ])
+                timeNodeCall('getBlockchainStatus', () => ledger.network.getBlockchainStatus())
+            ]))
 
             const isAtLeastVersion38 = isMinimumVersion38(blockchainStatus.version);
             let donatedAmount = Amount.Zero();
@@ -169,7 +172,7 @@ export async function calculateScore(accountId: string) {
             let isNodeOperatorSNR = false;
             if(isAtLeastVersion38){
                 const [_donatedAmount,] = await Promise.all([
-                    hasDonatedToSNA(ledger, accountId),
+                    timed(Metrics.ScorePhase, {phase: 'sna_donation'}, () => hasDonatedToSNA(ledger, accountId)),
                     // isNodeOperator(ledger, accountId),
                 ])
                 donatedAmount = _donatedAmount;
@@ -200,6 +203,7 @@ export async function calculateScore(accountId: string) {
             // THE LOOP - we are only going to loop through all transactions ONCE,
             // so do whatever you need to do in here and before/after.
             // TODO: refactor using a strategy pattern like thingy
+            const endLoop = startTimer(Metrics.ScorePhase, {phase: 'loop'});
             for (let i = 0; i < transactions.length; i++) {
 
                 // SCORE = step points + goal points (if all steps complete) + achievement points (if all goals complete)
@@ -547,6 +551,7 @@ export async function calculateScore(accountId: string) {
                     }
                 }
             }
+            endLoop();
 
 
             const upsertObj = {
@@ -558,14 +563,14 @@ export async function calculateScore(accountId: string) {
                 progress: JSON.stringify(progress)
             };
 
-            await prisma.address.upsert({
+            await timeDbQuery('address_upsert', () => prisma.address.upsert({
                 where: {
                     // @ts-ignore
                     address: accountId.toLowerCase()
                 },
                 update: upsertObj,
                 create: upsertObj
-            });
+            }));
         }
 
         const {rank: computedRank, total} = await calculateRankAndTotal(score);
@@ -602,5 +607,7 @@ export async function calculateScore(accountId: string) {
                 categoryScores: {}
             }
         }
+    } finally {
+        endTotal();
     }
 }
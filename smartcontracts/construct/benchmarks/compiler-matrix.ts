@@ -0,0 +1,239 @@
+/**
+ * Compiler setting matrix for the Construct contract
+ *
+ * Compiles the contract for each combination of `optimizationLevel` and `maxAuxVars`, checks the code size
+ * against the 10240 bytes budget and measures the execution cost of the standard scenarios on the testbed.
+ * Reports the cheapest valid setting; it is only written into the contract pragmas with `--apply`.
+ * Run the test suite after applying a new setting.
+ *
+ * Usage: npm run bench:compiler [-- --apply]
+ *
+ * SMARTC_OPTIMIZATION_LEVEL / SMARTC_MAX_AUX_VARS pin a setting instead of searching for it.
+ */
+import {mkdtempSync, readFileSync, writeFileSync} from "fs";
+import {tmpdir} from "os";
+import {join} from "path";
+import type {SimulatorTestbed} from "signum-smartc-testbed";
+import {Context} from "../context";
+import {
+    attack,
+    bootstrapTestbed,
+    CompilerSettings,
+    compileToBytecode,
+    configureToken,
+    DefaultRequiredInitializers,
+    getCurrentHitpoints,
+    readCompilerSettings,
+    timeLapse,
+    withCompilerSettings
+} from "../lib";
+
+const MAX_CODE_SIZE = 40 * 256; // 10240
+const STEP_FEE_PLANCK = 73_500n;
+const OPTIMIZATION_LEVELS = [0, 1, 2, 3, 4];
+const MAX_AUX_VARS = [1, 2, 3, 4, 5];
+
+type Scenario = {
+    name: string,
+    initializers: typeof DefaultRequiredInitializers,
+    setup?: (testbed: SimulatorTestbed) => void,
+    run: (testbed: SimulatorTestbed) => void,
+}
+
+const Token = {
+    Multiplier: 2001n,
+    Resistance: 2002n,
+    Addition: 2003n,
+    FractionalAddition: 2004n,
+}
+
+function configurePowerUps(testbed: SimulatorTestbed) {
+    configureToken({testbed, tokenId: Token.Multiplier, decimals: 0n, multiplier: 250n, tokenLimit: 3n})
+    configureToken({testbed, tokenId: Token.Resistance, decimals: 2n, multiplier: 90n})
+    configureToken({testbed, tokenId: Token.Addition, decimals: 0n, addition: 40n, tokenLimit: 5n})
+    configureToken({testbed, tokenId: Token.FractionalAddition, decimals: 6n, addition: 15n})
+}
+
+const AllPowerUps = [
+    {asset: Token.Multiplier, quantity: 2n},
+    {asset: Token.Resistance, quantity: 350n},
+    {asset: Token.Addition, quantity: 7n},
+    {asset: Token.FractionalAddition, quantity: 2_500_000n},
+]
+
+const Scenarios: Scenario[] = [
+    {
+        name: "signa attack",
+        initializers: DefaultRequiredInitializers,
+        run: testbed => attack({testbed, signa: 100n}),
+    },
+    {
+        name: "4 power-ups",
+        initializers: DefaultRequiredInitializers,
+        setup: configurePowerUps,
+        run: testbed => attack({testbed, signa: 500n, tokens: AllPowerUps}),
+    },
+    {
+        name: "cooldown penalty",
+        initializers: DefaultRequiredInitializers,
+        setup: configurePowerUps,
+        run: testbed => {
+            attack({testbed, signa: 100n})
+            attack({testbed, signa: 100n, tokens: AllPowerUps.slice(0, 3)})
+        },
+    },
+    {
+        name: "debuffed",
+        initializers: DefaultRequiredInitializers,
+        setup: testbed => testbed.sendTransactionAndGetResponse([{
+            sender: Context.CreatorAccount,
+            recipient: Context.ThisContract,
+            amount: Context.ActivationFee,
+            messageArr: [Context.Methods.SetDebuff, 100n, 20n, 3n],
+        }]),
+        run: testbed => {
+            attack({testbed, signa: 100n})
+            timeLapse({testbed, blocks: 20n})
+            attack({testbed, signa: 100n})
+        },
+    },
+    {
+        name: "defeat",
+        initializers: {...DefaultRequiredInitializers, maxHp: 100n, breachLimit: 100n},
+        run: testbed => {
+            attack({testbed, signa: 500n, sender: Context.SenderAccount1})
+            timeLapse({testbed, blocks: 2n})
+            attack({testbed, signa: 1000n, sender: Context.SenderAccount2})
+        },
+    },
+]
+
+type ScenarioResult = {
+    steps: bigint,
+    outcome: string,
+}
+
+type MatrixEntry = {
+    settings: CompilerSettings,
+    codeSize?: number,
+    results?: ScenarioResult[],
+    totalSteps?: bigint,
+    error?: string,
+}
+
+/**
+ * Execution fees are what is left of the contract balance change after all payments in and out.
+ */
+function measureSteps(testbed: SimulatorTestbed, run: () => void): bigint {
+    const balanceBefore = testbed.getContract().balance;
+    const txCount = testbed.getTransactions().length;
+    run();
+    let incoming = 0n;
+    let outgoing = 0n;
+    for (const tx of testbed.getTransactions().slice(txCount)) {
+        if (tx.recipient === Context.ThisContract) incoming += tx.amount;
+        if (tx.sender === Context.ThisContract) outgoing += tx.amount;
+    }
+    const fees = balanceBefore + incoming - outgoing - testbed.getContract().balance;
+    return fees / STEP_FEE_PLANCK;
+}
+
+function getOutcome(testbed: SimulatorTestbed) {
+    const tokensOf = (account: bigint) => (testbed.getAccount(account)?.tokens ?? [])
+        .map(t => `${t.asset}:${t.quantity}`)
+        .join(",");
+    return [
+        getCurrentHitpoints(testbed),
+        testbed.getContractMemoryValue("isDefeated"),
+        tokensOf(Context.SenderAccount1),
+        tokensOf(Context.SenderAccount2),
+    ].join("|");
+}
+
+function runMatrixEntry(source: string, settings: CompilerSettings, workDir: string): MatrixEntry {
+    const code = withCompilerSettings(source, settings);
+    try {
+        const codeSize = compileToBytecode(code).ByteCode.length / 2;
+        const contractPath = join(workDir, `construct.O${settings.optimizationLevel}.A${settings.maxAuxVars}.smart.c`);
+        writeFileSync(contractPath, code);
+
+        const results = Scenarios.map(scenario => {
+            const testbed = bootstrapTestbed(scenario.initializers, contractPath);
+            scenario.setup?.(testbed);
+            const steps = measureSteps(testbed, () => scenario.run(testbed));
+            return {steps, outcome: getOutcome(testbed)};
+        });
+        const totalSteps = results.reduce((sum, r) => sum + r.steps, 0n);
+        return {settings, codeSize, results, totalSteps};
+    } catch (e: any) {
+        return {settings, error: e.message ?? String(e)};
+    }
+}
+
+function pinned(envVar: string, values: number[]) {
+    const value = process.env[envVar];
+    return value !== undefined ? [Number(value)] : values;
+}
+
+function main() {
+    const apply = process.argv.includes("--apply");
+    const source = readFileSync(Context.ContractPath, "utf8");
+    const current = readCompilerSettings(source);
+    const workDir = mkdtempSync(join(tmpdir(), "construct-matrix-"));
+
+    // the current setting is the reference for the scenario outcomes
+    const reference = runMatrixEntry(source, current, workDir);
+    if (!reference.results) {
+        throw new Error(`Current contract settings do not compile/run: ${reference.error}`);
+    }
+
+    const matrix: MatrixEntry[] = [];
+    for (const optimizationLevel of pinned("SMARTC_OPTIMIZATION_LEVEL", OPTIMIZATION_LEVELS)) {
+        for (const maxAuxVars of pinned("SMARTC_MAX_AUX_VARS", MAX_AUX_VARS)) {
+            const entry = runMatrixEntry(source, {optimizationLevel, maxAuxVars}, workDir);
+            if (!entry.error && entry.codeSize! > MAX_CODE_SIZE) {
+                entry.error = "exceeds code size budget";
+            }
+            const mismatch = entry.results?.findIndex((r, i) => r.outcome !== reference.results![i].outcome) ?? -1;
+            if (!entry.error && mismatch >= 0) {
+                entry.error = `different outcome in "${Scenarios[mismatch].name}"`;
+            }
+            matrix.push(entry);
+        }
+    }
+
+    const valid = matrix.filter(e => !e.error);
+    const best = valid.sort((a, b) =>
+        a.totalSteps! === b.totalSteps! ? a.codeSize! - b.codeSize! : (a.totalSteps! < b.totalSteps! ? -1 : 1)
+    )[0];
+
+    console.log(`Code size budget: ${MAX_CODE_SIZE} bytes - current: O${current.optimizationLevel} A${current.maxAuxVars}\n`);
+    console.log(["setting", "bytes", ...Scenarios.map(s => s.name), "total steps", ""].join("\t"));
+    for (const entry of matrix) {
+        const {optimizationLevel, maxAuxVars} = entry.settings;
+        const marker = entry === best ? "★ best" : entry.error ?? "";
+        console.log([
+            `O${optimizationLevel} A${maxAuxVars}`,
+            entry.codeSize ?? "-",
+            ...Scenarios.map((_, i) => entry.results?.[i].steps ?? "-"),
+            entry.totalSteps ?? "-",
+            marker,
+        ].join("\t"));
+    }
+
+    if (!best) {
+        console.log("\nNo valid setting found");
+        process.exitCode = 1;
+        return;
+    }
+
+    const isCurrent = best.settings.optimizationLevel === current.optimizationLevel && best.settings.maxAuxVars === current.maxAuxVars;
+    if (isCurrent || !apply) {
+        console.log(`\nBest: O${best.settings.optimizationLevel} A${best.settings.maxAuxVars}${isCurrent ? " (already in use)" : " - run with --apply to use it"}`);
+        return;
+    }
+    writeFileSync(Context.ContractPath, withCompilerSettings(source, best.settings));
+    console.log(`\nApplied O${best.settings.optimizationLevel} A${best.settings.maxAuxVars} to ${Context.ContractPath}`);
+}
+
+main();
@@ -0,0 +1,39 @@
+/**
+ * Differential run of the contract damage pipeline against the reference model
+ * and the app's damage preview pipeline
+ *
+ * Usage: npm run bench:differential [-- <cases> <seed>]
+ *
+ * Exits with code 1 on any mismatch, printing the inputs to reproduce it.
+ */
+import {runDifferential} from "../reference/differential";
+
+const DefaultCases = 200_000;
+
+function main() {
+    const cases = Number(process.argv[2] ?? DefaultCases);
+    const seed = Number(process.argv[3] ?? Date.now() % 1_000_000);
+
+    console.log(`Running ${cases} attack cases (seed ${seed})...`);
+    const startedAt = performance.now();
+    const report = runDifferential(cases, seed);
+    const totalSeconds = (performance.now() - startedAt) / 1000;
+
+    const perSecond = (n: number, ms: number) => ms > 0 ? Math.round(n / (ms / 1000)) : n;
+    console.log(`Cases:      ${report.cases} in ${report.rounds} rounds, ${totalSeconds.toFixed(1)}s total`);
+    console.log(`Contract:   ${perSecond(report.cases, report.contractMs)} attacks/s`);
+    console.log(`Model:      ${perSecond(report.cases, report.modelMs)} attacks/s`);
+    console.log(`Throughput: ${perSecond(report.cases, totalSeconds * 1000)} cases/s (incl. setup)`);
+
+    if (report.mismatches.length > 0) {
+        console.log(`\n${report.mismatches.length} mismatches, first ones:`);
+        for (const m of report.mismatches.slice(0, 10)) {
+            console.log(JSON.stringify(m, (_, v) => typeof v === "bigint" ? v.toString() : v));
+        }
+        process.exitCode = 1;
+        return;
+    }
+    console.log("\nNo mismatches");
+}
+
+main();
@@ -2,15 +2,13 @@ import {describe, expect, test} from "vitest";
 
 import {SimulatorTestbed, utils} from "signum-smartc-testbed";
 import {Context} from "../context";
-import {getCurrentHitpoints, BootstrapScenario, DefaultRequiredInitializers, attack} from "../lib";
+import {bootstrapTestbed, bootstrapTestbedWith, getCurrentHitpoints, BootstrapScenario, DefaultRequiredInitializers, attack} from "../lib";
 
 const MAP_SET_FLAG = 1024n;
 
 describe('Construct Contract - Creator Configuration', () => {
     test('should have default initialization as expected', () => {
-        const testbed = new SimulatorTestbed(BootstrapScenario)
-            .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-            .runScenario();
+        const testbed = bootstrapTestbed();
         const name = testbed.getContractMemoryValue('name') ?? 0n;
         expect(utils.long2string(name)).toBe("CT000001")
         expect(testbed.getContractMemoryValue('xpTokenId')).toBe(Context.XPTokenId)
@@ -86,8 +84,7 @@ describe('Construct Contract - Creator Configuration', () => {
 
     describe('setBoni', () => {
         test('should setBoni as expected', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -95,15 +92,12 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetBoni, 500_0000_0000n, 2500_0000_0000n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('firstBloodBonus')).toBe(500_0000_0000n)
             expect(testbed.getContractMemoryValue('finalBlowBonus')).toBe(2500_0000_0000n)
         })
         test('should NOT setBoni as sender is not creator', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -111,15 +105,12 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetBoni, 500_0000_0000n, 2500_0000_0000n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('firstBloodBonus')).not.toBe(500_0000_0000n)
             expect(testbed.getContractMemoryValue('finalBlowBonus')).not.toBe(2500_0000_0000n)
         })
         test('should NOT setBoni as values are invalid', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -127,9 +118,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetBoni, -500_0000_0000n, -2500_0000_0000n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('firstBloodBonus')).not.toBe(-500_0000_0000n)
             expect(testbed.getContractMemoryValue('finalBlowBonus')).not.toBe(-2500_0000_0000n)
         })
@@ -137,8 +126,7 @@ describe('Construct Contract - Creator Configuration', () => {
 
     describe('setBreachLimit', () => {
         test('should set breach limit with valid value', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -146,14 +134,11 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetBreachLimit, 50n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('breachLimit')).toBe(50n)
         })
         test('should NOT set breach limit when sender is not creator', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -161,14 +146,11 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetBreachLimit, 50n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('breachLimit')).toBe(20n) // Should remain default
         })
         test('should NOT set breach limit with value <= 0', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -176,14 +158,11 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetBreachLimit, 0n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('breachLimit')).toBe(20n) // Should remain default
         })
         test('should NOT set breach limit with value > 100', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -191,14 +170,11 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetBreachLimit, 101n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('breachLimit')).toBe(20n) // Should remain default
         })
         test('should set breach limit with edge case value 1', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -206,14 +182,11 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetBreachLimit, 1n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('breachLimit')).toBe(1n)
         })
         test('should set breach limit with edge case value 99', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -221,9 +194,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetBreachLimit, 99n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('breachLimit')).toBe(99n)
         })
     })
@@ -232,8 +203,7 @@ describe('Construct Contract - Creator Configuration', () => {
         const TestTokenId = 5000n;
 
         test('should set damage multiplier with valid values', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -248,9 +218,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageMultiplier, TestTokenId, 150n, 20n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
 
             const hasWarning = testbed.blockchain.transactions.some(tx => tx.recipient === Context.CreatorAccount && tx.messageText?.startsWith("Unregistered Token"))
             expect(hasWarning).toBeFalsy();
@@ -259,8 +227,7 @@ describe('Construct Contract - Creator Configuration', () => {
             expect(testbed.getContractMapValue(Context.Maps.DamageTokenLimit, TestTokenId)).toBe(20n);
         })
         test('should set damage multiplier with valid values - but sends a warning that token is not registered', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -268,9 +235,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageMultiplier, TestTokenId, 150n, 20n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
 
             const hasWarning = testbed.blockchain.transactions.some(tx => tx.recipient === Context.CreatorAccount && tx.messageText?.startsWith("Unregistered Token"))
             expect(hasWarning).toBeTruthy();
@@ -280,8 +245,7 @@ describe('Construct Contract - Creator Configuration', () => {
         })
 
         test('should NOT set damage multiplier when sender is not creator', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -296,9 +260,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageMultiplier, TestTokenId, 150n, 1000n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             const hasWarning = testbed.blockchain.transactions.some(tx => tx.recipient === Context.CreatorAccount && tx.messageText?.startsWith("Unregistered Token"))
             expect(hasWarning).toBeFalsy();
 
@@ -308,8 +270,7 @@ describe('Construct Contract - Creator Configuration', () => {
         })
 
         test('should NOT set multiplier when value is 0', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -317,16 +278,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageMultiplier, TestTokenId, 0n, 1000n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.DamageMultiplier, TestTokenId)).toBe(0n); // Should not be set
             expect(testbed.getContractMapValue(Context.Maps.DamageTokenLimit, TestTokenId)).toBe(1000n);
         })
 
         test('should NOT set multiplier when value > 1000', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -334,16 +292,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageMultiplier, TestTokenId, 1001n, 1000n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.DamageMultiplier, TestTokenId)).toBe(0n); // Should not be set
             expect(testbed.getContractMapValue(Context.Maps.DamageTokenLimit, TestTokenId)).toBe(1000n);
         })
 
         test('should set multiplier with edge case value 1', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -351,16 +306,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageMultiplier, TestTokenId, 1n, 0n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.DamageMultiplier, TestTokenId)).toBe(1n);
             expect(testbed.getContractMapValue(Context.Maps.DamageTokenLimit, TestTokenId)).toBe(0n);
         })
 
         test('should set multiplier with edge case value 1000', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -368,9 +320,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageMultiplier, TestTokenId, 1000n, 5000n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.DamageMultiplier, TestTokenId)).toBe(1000n);
             expect(testbed.getContractMapValue(Context.Maps.DamageTokenLimit, TestTokenId)).toBe(5000n);
         })
@@ -379,8 +329,7 @@ describe('Construct Contract - Creator Configuration', () => {
     describe('setDamageAddition', () => {
         const TestTokenId = 5500n;
         test('should set damage addition with valid values and registered token', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -395,9 +344,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageAddition, TestTokenId, 50n, 100n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
 
             const hasWarning = testbed.blockchain.transactions.some(tx => tx.recipient === Context.CreatorAccount && tx.messageText?.startsWith("Unregistered Token"))
             expect(hasWarning).toBeFalsy();
@@ -406,8 +353,7 @@ describe('Construct Contract - Creator Configuration', () => {
         })
 
         test('should set damage addition with valid values - but sends a warning that token is not registered', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -415,9 +361,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageAddition, TestTokenId, 50n, 100n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
 
             const hasWarning = testbed.blockchain.transactions.some(tx => tx.recipient === Context.CreatorAccount && tx.messageText?.startsWith("Unregistered Token"))
             expect(hasWarning).toBeTruthy();
@@ -427,8 +371,7 @@ describe('Construct Contract - Creator Configuration', () => {
         })
 
         test('should NOT set damage addition when sender is not creator', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -436,16 +379,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageAddition, TestTokenId, 50n, 100n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.DamageAddition, TestTokenId)).toBe(0n);
             expect(testbed.getContractMapValue(Context.Maps.DamageTokenLimit, TestTokenId)).toBe(0n);
         })
 
         test('should NOT set damage addition when value is 0', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -453,17 +393,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageAddition, TestTokenId, 0n, 100n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.DamageAddition, TestTokenId)).toBe(0n);
             // But tokenLimit should still be set
             expect(testbed.getContractMapValue(Context.Maps.DamageTokenLimit, TestTokenId)).toBe(100n);
         })
 
         test('should NOT set damage addition when value is negative', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -471,17 +408,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageAddition, TestTokenId, -50n, 100n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.DamageAddition, TestTokenId)).toBe(0n);
             // But tokenLimit should still be set
             expect(testbed.getContractMapValue(Context.Maps.DamageTokenLimit, TestTokenId)).toBe(100n);
         })
 
         test('should set damage addition with edge case value 1', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -489,16 +423,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageAddition, TestTokenId, 1n, 0n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.DamageAddition, TestTokenId)).toBe(1n);
             expect(testbed.getContractMapValue(Context.Maps.DamageTokenLimit, TestTokenId)).toBe(0n);
         })
 
         test('should set damage addition with large value', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -506,16 +437,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageAddition, TestTokenId, 5000n, 10000n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.DamageAddition, TestTokenId)).toBe(5000n);
             expect(testbed.getContractMapValue(Context.Maps.DamageTokenLimit, TestTokenId)).toBe(10000n);
         })
 
         test('should set tokenLimit to 0 when value is exactly 0', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -523,16 +451,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageAddition, TestTokenId, 100n, 0n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.DamageAddition, TestTokenId)).toBe(100n);
             expect(testbed.getContractMapValue(Context.Maps.DamageTokenLimit, TestTokenId)).toBe(0n);
         })
 
         test('should NOT set tokenLimit when value is negative', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -540,9 +465,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDamageAddition, TestTokenId, 50n, -100n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.DamageAddition, TestTokenId)).toBe(50n);
             expect(testbed.getContractMapValue(Context.Maps.DamageTokenLimit, TestTokenId)).toBe(0n);
         })
@@ -550,8 +473,7 @@ describe('Construct Contract - Creator Configuration', () => {
 
     describe('setRewardDistribution', () => {
         test('should set reward distribution with valid values that sum to 100', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -559,17 +481,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRewardDistribution, 70n, 30n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('rewardDistribution_players')).toBe(70n);
             expect(testbed.getContractMemoryValue('rewardDistribution_treasury')).toBe(30n);
             // burn is implicit: 100 - 70 - 30 = 0
         })
 
         test('should set reward distribution with implicit burn', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -577,17 +496,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRewardDistribution, 80n, 10n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('rewardDistribution_players')).toBe(80n);
             expect(testbed.getContractMemoryValue('rewardDistribution_treasury')).toBe(10n);
             // burn is implicit: 100 - 80 - 10 = 10%
         })
 
         test('should NOT set reward distribution when sender is not creator', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -595,17 +511,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRewardDistribution, 70n, 20n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             // Should remain default values
             expect(testbed.getContractMemoryValue('rewardDistribution_players')).toBe(85n);
             expect(testbed.getContractMemoryValue('rewardDistribution_treasury')).toBe(5n);
         })
 
         test('should NOT set reward distribution when sum is greater than 100', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -613,17 +526,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRewardDistribution, 70n, 31n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             // Should remain default values (sum is 101, not <= 100)
             expect(testbed.getContractMemoryValue('rewardDistribution_players')).toBe(85n);
             expect(testbed.getContractMemoryValue('rewardDistribution_treasury')).toBe(5n);
         })
 
         test('should allow setting players to 0 (all to treasury)', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -631,17 +541,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRewardDistribution, 0n, 100n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             // All rewards go to treasury, no burn
             expect(testbed.getContractMemoryValue('rewardDistribution_players')).toBe(0n);
             expect(testbed.getContractMemoryValue('rewardDistribution_treasury')).toBe(100n);
         })
 
         test('should allow setting treasury to 0 (all to players+burn)', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -649,17 +556,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRewardDistribution, 90n, 0n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             // 90% players, 0% treasury, 10% burn (implicit)
             expect(testbed.getContractMemoryValue('rewardDistribution_players')).toBe(90n);
             expect(testbed.getContractMemoryValue('rewardDistribution_treasury')).toBe(0n);
         })
 
         test('should set reward distribution with edge case: all to players', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -667,17 +571,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRewardDistribution, 100n, 0n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             // All rewards go to players, nothing burned or to treasury
             expect(testbed.getContractMemoryValue('rewardDistribution_players')).toBe(100n);
             expect(testbed.getContractMemoryValue('rewardDistribution_treasury')).toBe(0n);
         })
 
         test('should set reward distribution with edge case: all to burn', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -685,17 +586,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRewardDistribution, 0n, 0n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             // 0% players, 0% treasury, 100% burn (implicit)
             expect(testbed.getContractMemoryValue('rewardDistribution_players')).toBe(0n);
             expect(testbed.getContractMemoryValue('rewardDistribution_treasury')).toBe(0n);
         })
 
         test('should set reward distribution with equal split', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -703,9 +601,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRewardDistribution, 33n, 33n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             // 33% players, 33% treasury, 34% burn (implicit)
             expect(testbed.getContractMemoryValue('rewardDistribution_players')).toBe(33n);
             expect(testbed.getContractMemoryValue('rewardDistribution_treasury')).toBe(33n);
@@ -738,9 +634,7 @@ describe('Construct Contract - Creator Configuration', () => {
         })
 
         test('should set reward NFT with invalid NFT ID', () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             testbed.sendTransactionAndGetResponse([{
                 amount: Context.ActivationFee,
@@ -775,8 +669,7 @@ describe('Construct Contract - Creator Configuration', () => {
 
     describe('setDebuff', () => {
         test('should set debuff with valid positive values', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -784,17 +677,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDebuff, 25n, 10n, 3n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('debuff_chance')).toBe(25n);
             expect(testbed.getContractMemoryValue('debuff_damageReduction')).toBe(10n);
             expect(testbed.getContractMemoryValue('debuff_maxStack')).toBe(3n);
         })
 
         test.skip('should set debuff with negative damageReduction (buff effect)', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -803,17 +693,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDebuff, 30n, -20n, 5n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('debuff_chance')).toBe(30n);
             expect(testbed.getContractMemoryValue('debuff_damageReduction')).toBe(-1n); // Negative = buff
             expect(testbed.getContractMemoryValue('debuff_maxStack')).toBe(5n);
         })
 
         test('should NOT set debuff when sender is not creator', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -821,9 +708,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDebuff, 25n, 10n, 3n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             // Should remain default (all 0)
             expect(testbed.getContractMemoryValue('debuff_chance')).toBe(0n);
             expect(testbed.getContractMemoryValue('debuff_damageReduction')).toBe(0n);
@@ -831,8 +716,7 @@ describe('Construct Contract - Creator Configuration', () => {
         })
 
         test('should NOT set chance when value is negative', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -840,17 +724,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDebuff, -10n, 15n, 3n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('debuff_chance')).toBe(0n); // Not set
             expect(testbed.getContractMemoryValue('debuff_damageReduction')).toBe(15n); // Set anyway
             expect(testbed.getContractMemoryValue('debuff_maxStack')).toBe(3n); // Set anyway
         })
 
         test('should NOT set maxStack when value is negative', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -858,17 +739,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDebuff, 20n, 10n, -5n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('debuff_chance')).toBe(20n); // Set
             expect(testbed.getContractMemoryValue('debuff_damageReduction')).toBe(10n); // Set
             expect(testbed.getContractMemoryValue('debuff_maxStack')).toBe(0n); // Not set
         })
 
         test('should set debuff with edge case: 0 chance disables debuff', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -876,17 +754,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDebuff, 0n, 20n, 5n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('debuff_chance')).toBe(0n);
             expect(testbed.getContractMemoryValue('debuff_damageReduction')).toBe(20n);
             expect(testbed.getContractMemoryValue('debuff_maxStack')).toBe(5n);
         })
 
         test('should set debuff with edge case: 100% chance', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -894,9 +769,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetDebuff, 100n, 50n, 10n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('debuff_chance')).toBe(100n);
             expect(testbed.getContractMemoryValue('debuff_damageReduction')).toBe(50n);
             expect(testbed.getContractMemoryValue('debuff_maxStack')).toBe(10n);
@@ -905,8 +778,7 @@ describe('Construct Contract - Creator Configuration', () => {
 
     describe('setRegeneration', () => {
         test('should set regeneration with valid values', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -914,16 +786,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRegeneration, 10n, 100n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('regeneration_blockInterval')).toBe(10n);
             expect(testbed.getContractMemoryValue('regeneration_hitpoints')).toBe(100n);
         })
 
         test('should NOT set regeneration when sender is not creator', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -931,17 +800,14 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRegeneration, 10n, 100n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             // Should remain default (0)
             expect(testbed.getContractMemoryValue('regeneration_blockInterval')).toBe(0n);
             expect(testbed.getContractMemoryValue('regeneration_hitpoints')).toBe(0n);
         })
 
         test('should NOT set blockInterval when value is negative', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -949,16 +815,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRegeneration, -10n, 100n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('regeneration_blockInterval')).toBe(0n); // Not set
             expect(testbed.getContractMemoryValue('regeneration_hitpoints')).toBe(100n); // Set anyway
         })
 
         test('should NOT set hitpoints when value is negative', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -966,16 +829,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRegeneration, 10n, -100n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('regeneration_blockInterval')).toBe(10n); // Set
             expect(testbed.getContractMemoryValue('regeneration_hitpoints')).toBe(0n); // Not set
         })
 
         test('should NOT set hitpoints when value exceeds maxHp', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -983,16 +843,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRegeneration, 10n, 60000n], // maxHp is 50000
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('regeneration_blockInterval')).toBe(10n); // Set
             expect(testbed.getContractMemoryValue('regeneration_hitpoints')).toBe(0n); // Not set (exceeds maxHp)
         })
 
         test('should set regeneration with edge case: hitpoints equals maxHp', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1000,16 +857,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRegeneration, 5n, 50000n], // maxHp is 50000
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('regeneration_blockInterval')).toBe(5n);
             expect(testbed.getContractMemoryValue('regeneration_hitpoints')).toBe(50000n);
         })
 
         test('should set regeneration with edge case: 0 values disable regeneration', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1017,9 +871,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetRegeneration, 0n, 0n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMemoryValue('regeneration_blockInterval')).toBe(0n);
             expect(testbed.getContractMemoryValue('regeneration_hitpoints')).toBe(0n);
         })
@@ -1028,8 +880,7 @@ describe('Construct Contract - Creator Configuration', () => {
     describe('heal', () => {
 
         test('should heal construct with valid hitpoints', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1037,16 +888,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.Heal, 1000n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
 
             expect(getCurrentHitpoints(testbed)).toBe(50000n);
         })
 
         test('should NOT heal when sender is not creator', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1054,16 +902,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.Heal, 1000n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
 
             expect(getCurrentHitpoints(testbed)).toBe(50000n);
         })
 
         test('should NOT heal when sent hitpoints is 0', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1071,16 +916,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.Heal, 0n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
 
             expect(getCurrentHitpoints(testbed)).toBe(50000n);
         })
 
         test('should NOT heal when hitpoints is negative', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1088,16 +930,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.Heal, -1000n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
 
             expect(getCurrentHitpoints(testbed)).toBe(50000n);
         })
 
         test('should cap healing at maxHp when healing would exceed max', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1105,16 +944,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.Heal, 60000n], // Exceeds maxHp
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
 
             expect(getCurrentHitpoints(testbed)).toBe(50000n);
         })
 
         test('should send healing message to creator', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1122,9 +958,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.Heal, 1000n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
 
             const hasHealingMessage = testbed.blockchain.transactions.some(tx =>
                 tx.recipient === Context.CreatorAccount && tx.messageText?.startsWith("HEALING:")
@@ -1133,17 +967,14 @@ describe('Construct Contract - Creator Configuration', () => {
         })
 
         test('should heal construct with valid hitpoints', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee + 3000_0000_0000n, // 3000 SIGNA -> 300 HP
                     sender: Context.SenderAccount1,
                     recipient: Context.ThisContract,
                 }
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
 
             const hp = getCurrentHitpoints(testbed);
             expect(hp).toBe(49700n);
@@ -1165,8 +996,7 @@ describe('Construct Contract - Creator Configuration', () => {
     describe('setTokenDecimals', () => {
         const TestTokenId = 6000n;
         test('should set token decimals with valid value', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1174,16 +1004,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetTokenDecimals, TestTokenId, 2n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             // Value should be stored with MAP_SET_FLAG added
             expect(testbed.getContractMapValue(Context.Maps.TokenDecimalsInfo, TestTokenId)).toBe(2n + MAP_SET_FLAG);
         })
 
         test('should NOT set token decimals when sender is not creator', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1191,15 +1018,12 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetTokenDecimals, TestTokenId, 2n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.TokenDecimalsInfo, TestTokenId)).toBe(0n);
         })
 
         test('should NOT set token decimals with value < 0', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1207,15 +1031,12 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetTokenDecimals, TestTokenId, -1n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.TokenDecimalsInfo, TestTokenId)).toBe(0n);
         })
 
         test('should NOT set token decimals with value > 6', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1223,15 +1044,12 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetTokenDecimals, TestTokenId, 7n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.TokenDecimalsInfo, TestTokenId)).toBe(0n);
         })
 
         test('should set token decimals with edge case value 0', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1239,16 +1057,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetTokenDecimals, TestTokenId, 0n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             // 0 is valid, should be stored with flag
             expect(testbed.getContractMapValue(Context.Maps.TokenDecimalsInfo, TestTokenId)).toBe(0n + MAP_SET_FLAG);
         })
 
         test('should set token decimals with edge case value 6', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1256,16 +1071,13 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetTokenDecimals, TestTokenId, 6n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             // 6 is max valid value, should be stored with flag
             expect(testbed.getContractMapValue(Context.Maps.TokenDecimalsInfo, TestTokenId)).toBe(6n + MAP_SET_FLAG);
         })
 
         test('should allow updating token decimals', () => {
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1273,9 +1085,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetTokenDecimals, TestTokenId, 2n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
             expect(testbed.getContractMapValue(Context.Maps.TokenDecimalsInfo, TestTokenId)).toBe(2n + MAP_SET_FLAG);
 
             // Update to different value
@@ -1295,8 +1105,7 @@ describe('Construct Contract - Creator Configuration', () => {
             const UnsetTokenId = 7000n;
             const ZeroDecimalTokenId = 7001n;
 
-            const testbed = new SimulatorTestbed([
-                ...BootstrapScenario,
+            const testbed = bootstrapTestbedWith([
                 {
                     blockheight: 2,
                     amount: Context.ActivationFee,
@@ -1304,9 +1113,7 @@ describe('Construct Contract - Creator Configuration', () => {
                     messageArr: [Context.Methods.SetTokenDecimals, ZeroDecimalTokenId, 0n],
                     recipient: Context.ThisContract,
                 },
-            ])
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            ]);
 
             // Unset token should return 0
             expect(testbed.getContractMapValue(Context.Maps.TokenDecimalsInfo, UnsetTokenId)).toBe(0n);
@@ -1317,9 +1124,7 @@ describe('Construct Contract - Creator Configuration', () => {
 
     describe('setActive', () => {
         test('should set contract to inactive and active state', () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
             expect(testbed.getContractMemoryValue('isActive')).toBe(1n)
             testbed.sendTransactionAndGetResponse([
                 {
@@ -1344,9 +1149,7 @@ describe('Construct Contract - Creator Configuration', () => {
 
         })
         test('should set contract to exactly "1"', () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
             expect(testbed.getContractMemoryValue('isActive')).toBe(1n)
             testbed.sendTransactionAndGetResponse([
                 {
@@ -1386,9 +1189,7 @@ describe('Construct Contract - Creator Configuration', () => {
             expect(testbed.getContractMemoryValue('isActive')).toBe(1n)
         })
         test('should NOT set contract to inactive and active state as sender is not creator', () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
             expect(testbed.getContractMemoryValue('isActive')).toBe(1n)
             testbed.sendTransactionAndGetResponse([
                 {
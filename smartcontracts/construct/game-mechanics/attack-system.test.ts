@@ -1,14 +1,11 @@
 import {describe, expect, test} from "vitest";
-import {SimulatorTestbed} from "signum-smartc-testbed";
 import {Context} from "../context";
-import {getCurrentHitpoints, DefaultRequiredInitializers, BootstrapScenario, attack, timeLapse} from "../lib";
+import {bootstrapTestbed, getCurrentHitpoints, DefaultRequiredInitializers, attack, timeLapse} from "../lib";
 
 describe('Attack Mechanics', () => {
     describe("Basic Attack Mechanics", () => {
         test("should NOT run when inactive", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             testbed.sendTransactionAndGetResponse([{
                 sender: Context.CreatorAccount,
@@ -26,13 +23,11 @@ describe('Attack Mechanics', () => {
         })
 
         test("should NOT run when defeated", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, {
-                    ...DefaultRequiredInitializers,
-                    maxHp: 100n,
-                    breachLimit: 100n,
-                })
-                .runScenario();
+            const testbed = bootstrapTestbed({
+                ...DefaultRequiredInitializers,
+                maxHp: 100n,
+                breachLimit: 100n,
+            });
 
             // First attack to defeat
             attack({testbed, signa: 1000n})
@@ -49,9 +44,7 @@ describe('Attack Mechanics', () => {
         })
 
         test("should deal basic damage with SIGNA only", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             const initialHp = getCurrentHitpoints(testbed)!;
 
@@ -66,9 +59,7 @@ describe('Attack Mechanics', () => {
         })
 
         test("should send XP and HP tokens to attacker", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             const initialHp = getCurrentHitpoints(testbed)!;
 
@@ -88,9 +79,7 @@ describe('Attack Mechanics', () => {
         })
 
         test("should track first blood", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             attack({testbed, signa: 100n, sender: Context.SenderAccount1})
 
@@ -103,9 +92,7 @@ describe('Attack Mechanics', () => {
         })
 
         test("should refund the attackers signa and tokens if construct is inactive", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             const PowerUpTokenId = 2000n;
 
@@ -142,13 +129,11 @@ describe('Attack Mechanics', () => {
 
     describe("Breach Limit Mechanics", () => {
         test("should limit damage per attack based on breach limit", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, {
-                    ...DefaultRequiredInitializers,
-                    maxHp: 10_000n,
-                    breachLimit: 10n, // Max 10% of current HP per attack
-                })
-                .runScenario();
+            const testbed = bootstrapTestbed({
+                ...DefaultRequiredInitializers,
+                maxHp: 10_000n,
+                breachLimit: 10n, // Max 10% of current HP per attack
+            });
 
             const initialHp = getCurrentHitpoints(testbed)!;
 
@@ -162,13 +147,11 @@ describe('Attack Mechanics', () => {
         })
 
         test("should allow full damage if below breach limit", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, {
-                    ...DefaultRequiredInitializers,
-                    maxHp: 10_000n,
-                    breachLimit: 50n, // Max 50% of current HP
-                })
-                .runScenario();
+            const testbed = bootstrapTestbed({
+                ...DefaultRequiredInitializers,
+                maxHp: 10_000n,
+                breachLimit: 50n, // Max 50% of current HP
+            });
 
             const initialHp = getCurrentHitpoints(testbed)!;
 
@@ -183,13 +166,11 @@ describe('Attack Mechanics', () => {
         })
 
         test("should breach limit edge cases - 1% (Minimum)", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, {
-                    ...DefaultRequiredInitializers,
-                    maxHp: 100n,
-                    breachLimit: 1n,
-                })
-                .runScenario();
+            const testbed = bootstrapTestbed({
+                ...DefaultRequiredInitializers,
+                maxHp: 100n,
+                breachLimit: 1n,
+            });
 
             const initialHp = getCurrentHitpoints(testbed)!;
 
@@ -204,13 +185,11 @@ describe('Attack Mechanics', () => {
         })
 
         test("should breach limit edge cases - 100% (Maximum)", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, {
-                    ...DefaultRequiredInitializers,
-                    maxHp: 1_000n,
-                    breachLimit: 100n,
-                })
-                .runScenario();
+            const testbed = bootstrapTestbed({
+                ...DefaultRequiredInitializers,
+                maxHp: 1_000n,
+                breachLimit: 100n,
+            });
 
             // Attack with excessive amount - one kill
             attack({testbed, signa: 20_000n})
@@ -228,13 +207,11 @@ describe('Attack Mechanics', () => {
         })
 
         test("should keep breach limit constant based on maxHp throughout battle", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, {
-                    ...DefaultRequiredInitializers,
-                    maxHp: 10_000n,
-                    breachLimit: 20n, // 20% of maxHp = 2000 damage cap
-                })
-                .runScenario();
+            const testbed = bootstrapTestbed({
+                ...DefaultRequiredInitializers,
+                maxHp: 10_000n,
+                breachLimit: 20n, // 20% of maxHp = 2000 damage cap
+            });
 
             const maxHp = 10_000n;
             const expectedMaxDamage = (maxHp * 20n) / 100n; // 2000
@@ -275,9 +252,7 @@ describe('Attack Mechanics', () => {
         const PowerUpTokenId = 2000n;
 
         test("should apply damage multiplier from tokens - buffing", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             // Configure token with 5x multiplier (500 = 5.00x)
             testbed.sendTransactionAndGetResponse([{
@@ -311,9 +286,7 @@ describe('Attack Mechanics', () => {
 
 
         test("should apply damage multiplier from tokens - debuffing", async () => {
-                    const testbed = new SimulatorTestbed(BootstrapScenario)
-                        .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                        .runScenario();
+                    const testbed = bootstrapTestbed();
 
                     // Configure token with 0.5x multiplier (50 = 0.5x)
                     testbed.sendTransactionAndGetResponse([{
@@ -360,9 +333,7 @@ describe('Attack Mechanics', () => {
                 })
 
         test("should apply damage addition from tokens", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             // Configure token with +100 damage addition
             testbed.sendTransactionAndGetResponse([{
@@ -395,9 +366,7 @@ describe('Attack Mechanics', () => {
         })
 
         test("should enforce token limit", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             // Configure token with 2x multiplier and limit of 5 tokens
             testbed.sendTransactionAndGetResponse([{
@@ -429,9 +398,7 @@ describe('Attack Mechanics', () => {
         })
 
         test("should apply multiple token modifiers in single attack", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             const Token1 = 2000n;
             const Token2 = 2001n;
@@ -535,9 +502,7 @@ describe('Attack Mechanics', () => {
         })
 
         test("should ignore unregistered tokens", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             const initialHp = getCurrentHitpoints(testbed)!;
 
@@ -556,9 +521,7 @@ describe('Attack Mechanics', () => {
 
     describe("Debuff Mechanics", () => {
         test("should apply debuff to reduce damage", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             // Configure debuff: 100% chance, 50% damage reduction, max 3 stacks
             testbed.sendTransactionAndGetResponse([{
@@ -589,9 +552,7 @@ describe('Attack Mechanics', () => {
         })
 
         test("should reduce debuff stack after application", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             // Configure debuff
             testbed.sendTransactionAndGetResponse([{
@@ -616,9 +577,7 @@ describe('Attack Mechanics', () => {
         })
 
         test("should not exceed max debuff stacks", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             // Configure debuff with max 2 stacks
             testbed.sendTransactionAndGetResponse([{
@@ -641,9 +600,7 @@ describe('Attack Mechanics', () => {
         })
 
         test("should never apply debuff when chance is 0%", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             // Configure debuff with 0% chance
             testbed.sendTransactionAndGetResponse([{
@@ -665,9 +622,7 @@ describe('Attack Mechanics', () => {
         })
 
         test("should apply debuff probabilistically with 50% chance", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             // Configure debuff with 50% chance
             testbed.sendTransactionAndGetResponse([{
@@ -712,13 +667,11 @@ describe('Attack Mechanics', () => {
         test("should scale counter attack chance when damage exceeds breach limit", async () => {
             // Use 100% counter attack chance for deterministic testing
             // maxHp: 1000, breachLimit: 10% = 100 max damage
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, {
-                    ...DefaultRequiredInitializers,
-                    maxHp: 1000n,
-                    breachLimit: 10n, // Different from default 20%
-                })
-                .runScenario();
+            const testbed = bootstrapTestbed({
+                ...DefaultRequiredInitializers,
+                maxHp: 1000n,
+                breachLimit: 10n, // Different from default 20%
+            });
 
             // Configure 100% counter chance for deterministic behavior
             testbed.sendTransactionAndGetResponse([{
@@ -742,13 +695,11 @@ describe('Attack Mechanics', () => {
 
         test("should use base chance when damage is below breach limit", async () => {
             // maxHp: 10000, breachLimit: 20% = 2000 max damage
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, {
-                    ...DefaultRequiredInitializers,
-                    maxHp: 10000n,
-                    breachLimit: 20n,
-                })
-                .runScenario();
+            const testbed = bootstrapTestbed({
+                ...DefaultRequiredInitializers,
+                maxHp: 10000n,
+                breachLimit: 20n,
+            });
 
             // Configure debuff: 10% base chance (low)
             testbed.sendTransactionAndGetResponse([{
@@ -784,13 +735,11 @@ describe('Attack Mechanics', () => {
         test("should scale counter attack chance proportionally", async () => {
             // Test with 100% chance to ensure counter attacks happen
             // maxHp: 1000, breachLimit: 10% = 100 max damage
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, {
-                    ...DefaultRequiredInitializers,
-                    maxHp: 1000n,
-                    breachLimit: 10n, // Different from default
-                })
-                .runScenario();
+            const testbed = bootstrapTestbed({
+                ...DefaultRequiredInitializers,
+                maxHp: 1000n,
+                breachLimit: 10n, // Different from default
+            });
 
             // Configure 100% counter chance
             testbed.sendTransactionAndGetResponse([{
@@ -817,9 +766,7 @@ describe('Attack Mechanics', () => {
 
     describe("Multiple Attackers", () => {
         test("should handle attacks from different accounts", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-                .runScenario();
+            const testbed = bootstrapTestbed();
 
             const initialHp = getCurrentHitpoints(testbed)!;
 
@@ -839,12 +786,10 @@ describe('Attack Mechanics', () => {
         })
 
         test("should track cooldowns independently per attacker", async () => {
-            const testbed = new SimulatorTestbed(BootstrapScenario)
-                .loadContract(Context.ContractPath, {
-                    ...DefaultRequiredInitializers,
-                    coolDownInBlocks: 15n,
-                })
-                .runScenario();
+            const testbed = bootstrapTestbed({
+                ...DefaultRequiredInitializers,
+                coolDownInBlocks: 15n,
+            });
 
             // Attacker 1 attacks
             attack({testbed, signa: 100n, sender: Context.SenderAccount1})
@@ -1,16 +1,13 @@
 import {describe, expect, test} from "vitest";
-import {SimulatorTestbed} from "signum-smartc-testbed";
-import {attack, BootstrapScenario, DefaultRequiredInitializers, getCurrentHitpoints, timeLapse} from "../lib";
+import {bootstrapTestbed, attack, DefaultRequiredInitializers, getCurrentHitpoints, timeLapse} from "../lib";
 import {Context} from "../context";
 
 describe("Cooldown Mechanics", () => {
     test("should prevent attack during cooldown", async () => {
-        const testbed = new SimulatorTestbed(BootstrapScenario)
-            .loadContract(Context.ContractPath, {
-                ...DefaultRequiredInitializers,
-                coolDownInBlocks: 15n,
-            })
-            .runScenario();
+        const testbed = bootstrapTestbed({
+            ...DefaultRequiredInitializers,
+            coolDownInBlocks: 15n,
+        });
 
         const initialHp = getCurrentHitpoints(testbed)!;
 
@@ -29,12 +26,10 @@ describe("Cooldown Mechanics", () => {
     })
 
     test("should refund 90% of SIGNA during cooldown", async () => {
-        const testbed = new SimulatorTestbed(BootstrapScenario)
-            .loadContract(Context.ContractPath, {
-                ...DefaultRequiredInitializers,
-                coolDownInBlocks: 15n,
-            })
-            .runScenario();
+        const testbed = bootstrapTestbed({
+            ...DefaultRequiredInitializers,
+            coolDownInBlocks: 15n,
+        });
 
         // First attack
         attack({testbed, signa: 100n})
@@ -51,12 +46,10 @@ describe("Cooldown Mechanics", () => {
     })
 
     test("should allow attack after cooldown expires", async () => {
-        const testbed = new SimulatorTestbed(BootstrapScenario)
-            .loadContract(Context.ContractPath, {
-                ...DefaultRequiredInitializers,
-                coolDownInBlocks: 10n,
-            })
-            .runScenario();
+        const testbed = bootstrapTestbed({
+            ...DefaultRequiredInitializers,
+            coolDownInBlocks: 10n,
+        });
 
         // First attack at block 1
         attack({testbed, signa: 100n})
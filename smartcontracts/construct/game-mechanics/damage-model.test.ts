@@ -0,0 +1,72 @@
+import {describe, expect, test} from "vitest";
+import {applyDebuff, applyTokenMultiplier, computeDamage, DamageInput, TokenInput} from "../reference/damage-model";
+import {runDifferential} from "../reference/differential";
+
+function token(overrides: Partial<TokenInput>): TokenInput {
+    return {multiplier: 0n, addition: 0n, tokenLimit: 0n, decimals: 0n, quantity: 1n, ...overrides};
+}
+
+function input(overrides: Partial<DamageInput> = {}): DamageInput {
+    return {
+        amount: 100_0000_0000n,
+        baseDamageRatio: 10n,
+        tokens: [],
+        debuffStacks: 0n,
+        debuffDamageReduction: 0n,
+        debuffMaxStack: 0n,
+        breachLimit: 20n,
+        maxHp: 50_000n,
+        currentHp: 50_000n,
+        ...overrides,
+    };
+}
+
+describe("Damage Reference Model", () => {
+
+    test("should match the known contract results", () => {
+        expect(computeDamage(input()).effectiveDamage).toBe(10n);
+        expect(computeDamage(input({tokens: [token({multiplier: 500n})]})).effectiveDamage).toBe(50n);
+        expect(computeDamage(input({tokens: [token({multiplier: 50n, quantity: 2n})]})).effectiveDamage).toBe(2n);
+        expect(computeDamage(input({tokens: [token({addition: 100n})]})).effectiveDamage).toBe(110n);
+        // additions first, then multipliers - in any token order
+        expect(computeDamage(input({
+            tokens: [
+                token({multiplier: 200n}),
+                token({addition: 50n}),
+                token({multiplier: 300n}),
+                token({addition: 100n}),
+            ]
+        })).effectiveDamage).toBe(960n);
+    })
+
+    test("should interpolate fractional resistance tokens", () => {
+        // 0.5 tokens × 94 = 97 effective multiplier
+        expect(applyTokenMultiplier(100n, token({multiplier: 94n, decimals: 2n, quantity: 50n}))).toBe(97n);
+    })
+
+    test("should cap counted tokens at the token limit", () => {
+        expect(computeDamage(input({tokens: [token({multiplier: 200n, tokenLimit: 5n, quantity: 10n})]})).effectiveDamage).toBe(100n);
+    })
+
+    test("should cap debuff stacks and never go negative", () => {
+        expect(applyDebuff(100n, 5n, 10n, 3n)).toBe(70n);
+        expect(applyDebuff(100n, 2n, 80n, 0n)).toBe(0n);
+        expect(applyDebuff(100n, 1n, -50n, 3n)).toBe(150n);
+    })
+
+    test("should apply breach limit and defeat", () => {
+        const breached = computeDamage(input({amount: 100_000_0000_0000n, maxHp: 10_000n, breachLimit: 10n, currentHp: 10_000n}));
+        expect(breached.effectiveDamage).toBe(1_000n);
+        expect(breached.breachLimitHit).toBeTruthy();
+
+        const defeated = computeDamage(input({currentHp: 5n}));
+        expect(defeated.effectiveDamage).toBe(5n);
+        expect(defeated.isDefeated).toBeTruthy();
+    })
+
+    test("should match the compiled contract for random attacks", () => {
+        const report = runDifferential(300, 42);
+        expect(report.cases).toBe(300);
+        expect(report.mismatches).toEqual([]);
+    })
+})
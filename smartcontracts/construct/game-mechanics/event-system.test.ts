@@ -1,6 +1,6 @@
 import {describe, expect, test} from "vitest";
 import {SimulatorTestbed} from "signum-smartc-testbed";
-import {attack, BootstrapScenario, DefaultRequiredInitializers, timeLapse} from "../lib";
+import {bootstrapTestbed, attack, DefaultRequiredInitializers, timeLapse} from "../lib";
 import {Context} from "../context";
 
 describe("Event System", () => {
@@ -16,9 +16,7 @@ describe("Event System", () => {
     }
 
     test("should send event when toggling active status", async () => {
-        const testbed = new SimulatorTestbed(BootstrapScenario)
-            .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-            .runScenario();
+        const testbed = bootstrapTestbed();
 
         // Set event listener
         testbed.sendTransactionAndGetResponse([{
@@ -52,9 +50,7 @@ describe("Event System", () => {
     })
 
     test("should send event when construct is hit", async () => {
-        const testbed = new SimulatorTestbed(BootstrapScenario)
-            .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-            .runScenario();
+        const testbed = bootstrapTestbed();
 
         // Set event listener
         testbed.sendTransactionAndGetResponse([{
@@ -73,9 +69,7 @@ describe("Event System", () => {
     })
 
     test("should send event when construct is healed", async () => {
-        const testbed = new SimulatorTestbed(BootstrapScenario)
-            .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-            .runScenario();
+        const testbed = bootstrapTestbed();
 
         // Set event listener
         testbed.sendTransactionAndGetResponse([{
@@ -104,9 +98,7 @@ describe("Event System", () => {
     })
 
     test("should send event when counter attack occurs", async () => {
-        const testbed = new SimulatorTestbed(BootstrapScenario)
-            .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-            .runScenario();
+        const testbed = bootstrapTestbed();
 
         // Set event listener
         testbed.sendTransactionAndGetResponse([{
@@ -131,13 +123,11 @@ describe("Event System", () => {
     })
 
     test("should send event when construct is defeated", async () => {
-        const testbed = new SimulatorTestbed(BootstrapScenario)
-            .loadContract(Context.ContractPath, {
-                ...DefaultRequiredInitializers,
-                maxHp: 100n,
-                breachLimit: 100n,
-            })
-            .runScenario();
+        const testbed = bootstrapTestbed({
+            ...DefaultRequiredInitializers,
+            maxHp: 100n,
+            breachLimit: 100n,
+        });
 
         // Set event listener
         testbed.sendTransactionAndGetResponse([{
@@ -156,9 +146,7 @@ describe("Event System", () => {
     })
 
     test("should NOT send events when listener is not configured", async () => {
-        const testbed = new SimulatorTestbed(BootstrapScenario)
-            .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-            .runScenario();
+        const testbed = bootstrapTestbed();
 
         // No event listener configured
         // Attack
@@ -169,9 +157,7 @@ describe("Event System", () => {
     })
 
     test("should NOT send events to the listener when listener is the sender", async () => {
-        const testbed = new SimulatorTestbed(BootstrapScenario)
-            .loadContract(Context.ContractPath, DefaultRequiredInitializers)
-            .runScenario();
+        const testbed = bootstrapTestbed();
 
         // Set event listener to the account that will attack
         testbed.sendTransactionAndGetResponse([{
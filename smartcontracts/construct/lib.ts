@@ -1,4 +1,4 @@
-import type {SimulatorTestbed, TransactionObj} from "signum-smartc-testbed";
+import {SimulatorTestbed, type TransactionObj} from "signum-smartc-testbed";
 import {Context} from "./context";
 import {SmartC} from "smartc-signum-compiler";
 
@@ -83,3 +83,182 @@ export const BootstrapScenario: TransactionObj[] = [
         recipient: Context.ThisContract,
     }
 ]
+
+
+/**
+ * Deep copies an object graph, keeping prototypes, so class instances of the simulator stay functional.
+ * Functions are shared, everything else is copied.
+ */
+function deepClone<T>(value: T, seen = new WeakMap<object, any>()): T {
+    if (value === null || typeof value !== "object") {
+        return value;
+    }
+    const source = value as unknown as object;
+    if (seen.has(source)) {
+        return seen.get(source);
+    }
+    if (ArrayBuffer.isView(source)) {
+        const copy = (source as any).slice();
+        seen.set(source, copy);
+        return copy;
+    }
+    if (source instanceof ArrayBuffer) {
+        const copy = source.slice(0);
+        seen.set(source, copy);
+        return copy as T;
+    }
+    if (source instanceof Date) {
+        return new Date(source.getTime()) as T;
+    }
+    if (source instanceof Map) {
+        const copy = new Map();
+        seen.set(source, copy);
+        source.forEach((v, k) => copy.set(deepClone(k, seen), deepClone(v, seen)));
+        return copy as T;
+    }
+    if (source instanceof Set) {
+        const copy = new Set();
+        seen.set(source, copy);
+        source.forEach(v => copy.add(deepClone(v, seen)));
+        return copy as T;
+    }
+
+    const copy = Array.isArray(source) ? [] : Object.create(Object.getPrototypeOf(source));
+    seen.set(source, copy);
+    for (const key of Reflect.ownKeys(source)) {
+        const descriptor = Object.getOwnPropertyDescriptor(source, key)!;
+        if ("value" in descriptor) {
+            descriptor.value = deepClone(descriptor.value, seen);
+        }
+        Object.defineProperty(copy, key, descriptor);
+    }
+    return copy;
+}
+
+/**
+ * Creates an independent copy of the testbed, including chain and contract state.
+ */
+export function forkTestbed(testbed: SimulatorTestbed): SimulatorTestbed {
+    return deepClone(testbed);
+}
+
+const bootstrapSnapshots = new Map<string, SimulatorTestbed>();
+
+const snapshotKey = (contractPath: string, initializers: object) =>
+    contractPath + JSON.stringify(initializers, (_, v) => typeof v === "bigint" ? v.toString() + "n" : v);
+
+function getSnapshot(scenario: TransactionObj[], initializers: typeof DefaultRequiredInitializers, contractPath: string) {
+    const key = snapshotKey(contractPath, {scenario, initializers});
+    let snapshot = bootstrapSnapshots.get(key);
+    if (!snapshot) {
+        snapshot = new SimulatorTestbed(scenario)
+            .loadContract(contractPath, initializers)
+            .runScenario();
+        bootstrapSnapshots.set(key, snapshot);
+    }
+    return forkTestbed(snapshot);
+}
+
+/**
+ * Returns a testbed with the contract loaded and the `BootstrapScenario` executed.
+ *
+ * Compilation and bootstrap run once per process and initializer set; each call returns a fork of that snapshot,
+ * so tests cannot affect each other. Set `TESTBED_NO_SNAPSHOT=1` to bootstrap from scratch for every test.
+ */
+export function bootstrapTestbed(initializers: typeof DefaultRequiredInitializers = DefaultRequiredInitializers, contractPath = Context.ContractPath): SimulatorTestbed {
+    if (process.env.TESTBED_NO_SNAPSHOT) {
+        return new SimulatorTestbed(BootstrapScenario)
+            .loadContract(contractPath, initializers)
+            .runScenario();
+    }
+    return getSnapshot(BootstrapScenario, initializers, contractPath);
+}
+
+/**
+ * Same as running `[...BootstrapScenario, ...steps]` as scenario, for tests that configure the contract
+ * in the bootstrap blocks.
+ *
+ * Forks a snapshot taken after block 1 and sends the remaining bootstrap transaction together with the steps,
+ * one block per blockheight, so only the steps of the test are executed.
+ */
+export function bootstrapTestbedWith(steps: TransactionObj[], initializers: typeof DefaultRequiredInitializers = DefaultRequiredInitializers, contractPath = Context.ContractPath): SimulatorTestbed {
+    const scenario = [...BootstrapScenario, ...steps];
+    if (process.env.TESTBED_NO_SNAPSHOT) {
+        return new SimulatorTestbed(scenario)
+            .loadContract(contractPath, initializers)
+            .runScenario();
+    }
+
+    const firstBlock = scenario.filter(tx => tx.blockheight === 1);
+    const testbed = getSnapshot(firstBlock, initializers, contractPath);
+
+    const blocks = new Map<number, TransactionObj[]>();
+    scenario.filter(tx => tx.blockheight! > 1).forEach(tx => {
+        const block = blocks.get(tx.blockheight!) ?? [];
+        block.push(tx);
+        blocks.set(tx.blockheight!, block);
+    });
+
+    let height = 1;
+    Array.from(blocks.keys()).sort((a, b) => a - b).forEach(blockheight => {
+        timeLapse({testbed, blocks: BigInt(blockheight - height - 1)});
+        testbed.sendTransactionAndGetResponse(blocks.get(blockheight)!.map(({blockheight: _, ...tx}) => tx));
+        height = blockheight;
+    });
+    return testbed;
+}
+
+type TokenModifier = {
+    testbed: SimulatorTestbed,
+    tokenId: bigint,
+    decimals?: bigint,
+    multiplier?: bigint,
+    addition?: bigint,
+    tokenLimit?: bigint,
+}
+
+/**
+ * Registers a power-up token with its decimals and damage modifiers, as the creator would do.
+ * Without decimals the token stays unregistered.
+ */
+export function configureToken({testbed, tokenId, decimals, multiplier, addition, tokenLimit = 0n}: TokenModifier) {
+    const send = (messageArr: bigint[]) => testbed.sendTransactionAndGetResponse([{
+        sender: Context.CreatorAccount,
+        recipient: Context.ThisContract,
+        amount: Context.ActivationFee,
+        messageArr,
+    }])
+
+    if (decimals !== undefined) {
+        send([Context.Methods.SetTokenDecimals, tokenId, decimals])
+    }
+    if (multiplier !== undefined) {
+        send([Context.Methods.SetDamageMultiplier, tokenId, multiplier, tokenLimit])
+    }
+    if (addition !== undefined) {
+        send([Context.Methods.SetDamageAddition, tokenId, addition, tokenLimit])
+    }
+}
+
+export type CompilerSettings = {
+    optimizationLevel: number,
+    maxAuxVars: number,
+}
+
+/**
+ * Replaces the compiler pragmas of the given contract source.
+ */
+export function withCompilerSettings(code: string, {optimizationLevel, maxAuxVars}: CompilerSettings) {
+    return code
+        .replace(/^#pragma optimizationLevel \d+/m, `#pragma optimizationLevel ${optimizationLevel}`)
+        .replace(/^#pragma maxAuxVars \d+/m, `#pragma maxAuxVars ${maxAuxVars}`);
+}
+
+export function readCompilerSettings(code: string): CompilerSettings {
+    const optimizationLevel = code.match(/^#pragma optimizationLevel (\d+)/m);
+    const maxAuxVars = code.match(/^#pragma maxAuxVars (\d+)/m);
+    return {
+        optimizationLevel: Number(optimizationLevel?.[1] ?? 2),
+        maxAuxVars: Number(maxAuxVars?.[1] ?? 3),
+    };
+}
@@ -0,0 +1,155 @@
+/**
+ * Reference model of the Construct damage pipeline
+ *
+ * Mirrors the integer math of construct.contract.smart.c step by step, including the order of operations,
+ * truncating division and 64-bit wrap-around, so the contract can be checked against it:
+ *
+ * calculateSignaDamage -> applyTokenModifiers (additions, then multipliers) -> applyDebuff -> applyBreachLimit
+ *
+ * Deliberately written like the contract code, not optimized - do not "improve" the math here.
+ */
+
+export type TokenModifierConfig = {
+    /** damage multiplier in percent, 0 = not set */
+    multiplier: bigint,
+    /** flat damage addition per token, 0 = not set */
+    addition: bigint,
+    /** max. counted tokens (whole tokens), 0 = unlimited */
+    tokenLimit: bigint,
+    /** registered token decimals, unregistered tokens count as 0 */
+    decimals: bigint,
+}
+
+export type TokenInput = TokenModifierConfig & {
+    /** quantity in raw units (QNT) */
+    quantity: bigint,
+}
+
+export type DamageInput = {
+    /** attack amount in planck, without activation fee */
+    amount: bigint,
+    baseDamageRatio: bigint,
+    /** up to 4 power-ups, as attached to the transaction */
+    tokens: TokenInput[],
+    debuffStacks: bigint,
+    debuffDamageReduction: bigint,
+    debuffMaxStack: bigint,
+    breachLimit: bigint,
+    maxHp: bigint,
+    currentHp: bigint,
+}
+
+export type DamageResult = {
+    /** damage before the breach limit, used for the counter attack chance */
+    preBreachDamage: bigint,
+    breachLimitHit: boolean,
+    /** damage actually dealt, capped by the current hitpoints */
+    effectiveDamage: bigint,
+    isDefeated: boolean,
+}
+
+// the contract computes with signed 64-bit longs
+const long = (n: bigint) => BigInt.asIntN(64, n);
+
+export function pow10(exp: bigint): bigint {
+    switch (exp) {
+        case 0n: return 1n;
+        case 1n: return 10n;
+        case 2n: return 100n;
+        case 3n: return 1000n;
+        case 4n: return 10000n;
+        case 5n: return 100000n;
+        case 6n: return 1000000n;
+        default: return 1n;
+    }
+}
+
+export function calculateSignaDamage(amount: bigint, baseDamageRatio: bigint): bigint {
+    return long(amount * baseDamageRatio) / 100_0000_0000n;
+}
+
+function limitQuantity(token: TokenInput): bigint {
+    if (token.tokenLimit > 0n) {
+        const tokenLimitRaw = long(token.tokenLimit * pow10(token.decimals));
+        if (token.quantity > tokenLimitRaw) {
+            return tokenLimitRaw;
+        }
+    }
+    return token.quantity;
+}
+
+export function applyTokenAddition(token: TokenInput): bigint {
+    if (token.quantity === 0n) return 0n;
+    if (token.addition === 0n) return 0n;
+    const quantity = limitQuantity(token);
+    return long(token.addition * quantity) / pow10(token.decimals);
+}
+
+export function applyTokenMultiplier(damage: bigint, token: TokenInput): bigint {
+    if (token.quantity === 0n) return damage;
+    const multiplier = token.multiplier;
+    if (multiplier === 0n) return damage;
+
+    const quantity = limitQuantity(token);
+    const p = pow10(token.decimals);
+
+    if (multiplier < 100n) {
+        const quantityInt = quantity / p;
+        for (let i = 0n; i < quantityInt; i++) {
+            damage = long(damage * multiplier) / 100n;
+            // stays 0 from here on - shortcut for the model only, the contract keeps looping
+            if (damage === 0n) break;
+        }
+        const fractional = quantity % p;
+        if (fractional > 0n) {
+            const fractionalMultiplier = 100n - long((100n - multiplier) * fractional) / p;
+            damage = long(damage * fractionalMultiplier) / 100n;
+        }
+        return damage;
+    }
+    return long((long(damage * multiplier) / 100n) * quantity) / p;
+}
+
+export function applyTokenModifiers(baseDamage: bigint, tokens: TokenInput[]): bigint {
+    let damage = baseDamage;
+    let totalAddition = 0n;
+    for (const token of tokens) {
+        totalAddition = long(totalAddition + applyTokenAddition(token));
+    }
+    damage = long(damage + totalAddition);
+    for (const token of tokens) {
+        damage = applyTokenMultiplier(damage, token);
+    }
+    return damage;
+}
+
+export function applyDebuff(damage: bigint, stacks: bigint, damageReduction: bigint, maxStack: bigint): bigint {
+    if (stacks <= 0n) return damage;
+    if (maxStack > 0n && stacks > maxStack) {
+        stacks = maxStack;
+    }
+    const totalReduction = long(stacks * damageReduction);
+    const modifiedDamage = long(damage * long(100n - totalReduction)) / 100n;
+    return modifiedDamage < 0n ? 0n : modifiedDamage;
+}
+
+export function applyBreachLimit(damage: bigint, maxHp: bigint, breachLimit: bigint): bigint {
+    if (breachLimit <= 0n) return damage;
+    const maxDamage = long(maxHp * breachLimit) / 100n;
+    return damage > maxDamage ? maxDamage : damage;
+}
+
+export function computeDamage(input: DamageInput): DamageResult {
+    let totalDamage = applyTokenModifiers(calculateSignaDamage(input.amount, input.baseDamageRatio), input.tokens);
+    if (input.debuffStacks > 0n) {
+        totalDamage = applyDebuff(totalDamage, input.debuffStacks, input.debuffDamageReduction, input.debuffMaxStack);
+    }
+    const preBreachDamage = totalDamage;
+    let effectiveDamage = applyBreachLimit(totalDamage, input.maxHp, input.breachLimit);
+    const breachLimitHit = effectiveDamage < preBreachDamage;
+    const isDefeated = effectiveDamage >= input.currentHp;
+    if (isDefeated) {
+        effectiveDamage = input.currentHp;
+    }
+    return {preBreachDamage, breachLimitHit, effectiveDamage, isDefeated};
+}
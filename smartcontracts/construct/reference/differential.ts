@@ -0,0 +1,212 @@
+/**
+ * Randomized differential check of the compiled contract against the damage reference model
+ *
+ * Each round forks a bootstrapped testbed, configures four power-ups with random decimals, modifiers and limits,
+ * a random breach limit and debuff, and then attacks with random amounts and token quantities until the construct
+ * is defeated. Every attack's damage is compared with what the model computes from the same state, and with the
+ * damage pipeline of the app (lib/construct/damagePipeline.ts), which shows players the expected damage.
+ *
+ * Debuff stacks above 1 cannot be reached through transactions (an attack consumes a stack before the counter
+ * attack adds one), so attacks run with 0 or 1 stacks - deeper stacks are covered by the model unit tests.
+ */
+import type {SimulatorTestbed} from "signum-smartc-testbed";
+import {Context} from "../context";
+import {bootstrapTestbed, configureToken, DefaultRequiredInitializers, getCurrentHitpoints, timeLapse} from "../lib";
+import {computeDamage, DamageInput, TokenModifierConfig} from "./damage-model";
+import {computeDamagePreview, DamageModifiers} from "../../../lib/construct/damagePipeline";
+
+const TokenIds = [2001n, 2002n, 2003n, 2004n];
+const AttacksPerRound = 50;
+
+const Initializers = {
+    ...DefaultRequiredInitializers,
+    coolDownInBlocks: 1n,
+}
+
+export type Mismatch = {
+    seed: number,
+    input: DamageInput,
+    expected: bigint,
+    actual: bigint,
+    /** damage computed by the app's pipeline */
+    preview: bigint,
+}
+
+export type DifferentialReport = {
+    cases: number,
+    rounds: number,
+    mismatches: Mismatch[],
+    contractMs: number,
+    modelMs: number,
+}
+
+type TokenSetup = TokenModifierConfig & { registered: boolean }
+
+/**
+ * Small seeded PRNG (mulberry32), so failing runs can be reproduced by seed.
+ */
+function createRandom(seed: number) {
+    let state = seed >>> 0;
+    const next = () => {
+        state = (state + 0x6D2B79F5) >>> 0;
+        let t = state;
+        t = Math.imul(t ^ (t >>> 15), t | 1);
+        t ^= t + Math.imul(t ^ (t >>> 7), t | 61);
+        return ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+    };
+    const int = (min: number, max: number) => min + Math.floor(next() * (max - min + 1));
+    const chance = (p: number) => next() < p;
+    return {int, chance, bigint: (min: number, max: number) => BigInt(int(min, max))};
+}
+
+type Random = ReturnType<typeof createRandom>;
+
+function randomTokenSetup(random: Random): TokenSetup {
+    const registered = random.chance(0.9);
+    const multiplier = random.chance(0.4) ? 0n : random.chance(0.5) ? random.bigint(1, 99) : random.bigint(100, 1000);
+    return {
+        registered,
+        decimals: registered ? random.bigint(0, 6) : 0n,
+        multiplier,
+        addition: random.chance(0.5) ? 0n : random.bigint(1, 500),
+        tokenLimit: random.chance(0.5) ? 0n : random.bigint(1, 20),
+    };
+}
+
+function randomQuantity(random: Random, setup: TokenSetup): bigint {
+    const unit = 10n ** setup.decimals;
+    // resistance tokens loop per whole token in the contract - keep those in a sane range
+    if (setup.multiplier > 0n && setup.multiplier < 100n) {
+        return random.bigint(1, 50) * unit / random.bigint(1, 4) || 1n;
+    }
+    const maxTokens = Number(setup.tokenLimit > 0n ? setup.tokenLimit * 3n : 20n);
+    const whole = random.bigint(0, maxTokens) * unit;
+    const fraction = setup.decimals > 0n && random.chance(0.5) ? random.bigint(1, Number(unit) - 1) : 0n;
+    return whole + fraction || 1n;
+}
+
+function setupRound(random: Random) {
+    const testbed = bootstrapTestbed(Initializers);
+    const tokens = TokenIds.map(() => randomTokenSetup(random));
+    tokens.forEach((setup, i) => configureToken({
+        testbed,
+        tokenId: TokenIds[i],
+        decimals: setup.registered ? setup.decimals : undefined,
+        multiplier: setup.multiplier,
+        addition: setup.addition > 0n ? setup.addition : undefined,
+        tokenLimit: setup.tokenLimit,
+    }));
+
+    const breachLimit = random.bigint(1, 100);
+    const debuffDamageReduction = random.chance(0.3) ? 0n : random.bigint(-50, 100);
+    const debuffMaxStack = random.bigint(0, 3);
+    const sendConfig = (messageArr: bigint[]) => testbed.sendTransactionAndGetResponse([{
+        sender: Context.CreatorAccount,
+        recipient: Context.ThisContract,
+        amount: Context.ActivationFee,
+        messageArr,
+    }]);
+    sendConfig([Context.Methods.SetBreachLimit, breachLimit]);
+    sendConfig([Context.Methods.SetDebuff, 100n, debuffDamageReduction, debuffMaxStack]);
+    timeLapse({testbed, blocks: 1n});
+
+    return {testbed, tokens, breachLimit, debuffDamageReduction, debuffMaxStack};
+}
+
+/**
+ * Runs the app's damage pipeline on the same input as the model.
+ */
+function previewDamage(input: DamageInput, tokenIds: bigint[]): bigint {
+    const modifiers: DamageModifiers = {};
+    input.tokens.forEach((t, idx) => {
+        modifiers[tokenIds[idx].toString()] = {
+            multiplier: t.multiplier,
+            addition: t.addition,
+            tokenLimit: t.tokenLimit,
+            decimals: t.decimals,
+        };
+    });
+    const preview = computeDamagePreview({
+        amount: input.amount,
+        tokens: input.tokens.map((t, idx) => ({tokenId: tokenIds[idx].toString(), quantity: t.quantity})),
+        construct: {
+            baseDamageRatio: Number(input.baseDamageRatio),
+            breachLimit: Number(input.breachLimit),
+            maxHp: Number(input.maxHp),
+            currentHp: Number(input.currentHp),
+            debuffDamageReduction: Number(input.debuffDamageReduction),
+            debuffMaxStack: Number(input.debuffMaxStack),
+        },
+        debuffStacks: Number(input.debuffStacks),
+        modifiers,
+    });
+    return BigInt(preview.effectiveDamage);
+}
+
+function sendAttack(testbed: SimulatorTestbed, sender: bigint, amount: bigint, tokens: Array<{ asset: bigint, quantity: bigint }>) {
+    testbed.sendTransactionAndGetResponse([{
+        sender,
+        recipient: Context.ThisContract,
+        amount: amount + Context.ActivationFee,
+        tokens,
+    }]);
+}
+
+/**
+ * Runs `cases` random attacks against the contract and compares each damage with the model.
+ */
+export function runDifferential(cases: number, seed = 1): DifferentialReport {
+    const random = createRandom(seed);
+    const report: DifferentialReport = {cases: 0, rounds: 0, mismatches: [], contractMs: 0, modelMs: 0};
+    let nextSender = 100_000n;
+
+    while (report.cases < cases) {
+        const round = setupRound(random);
+        const {testbed} = round;
+        report.rounds++;
+
+        for (let i = 0; i < AttacksPerRound && report.cases < cases; i++) {
+            const sender = nextSender++;
+            if (random.chance(0.3)) {
+                // primer attack, so the sender may carry a debuff stack into the checked attack
+                sendAttack(testbed, sender, 1_0000_0000n, []);
+                timeLapse({testbed, blocks: 1n});
+            }
+            if (testbed.getContractMemoryValue("isDefeated") === 1n) break;
+
+            const amount = random.chance(0.1) ? random.bigint(0, 1_0000_0000) : random.bigint(1, 5000) * 1_0000_0000n + random.bigint(0, 9999_9999);
+            const slots = TokenIds.map((_, idx) => idx).filter(() => random.chance(0.7));
+            const attached = slots.map(idx => ({asset: TokenIds[idx], quantity: randomQuantity(random, round.tokens[idx])}));
+
+            const input: DamageInput = {
+                amount,
+                baseDamageRatio: testbed.getContractMemoryValue("baseDamageRatio")!,
+                tokens: attached.map((t, idx) => ({...round.tokens[slots[idx]], quantity: t.quantity})),
+                debuffStacks: testbed.getContractMapValue(Context.Maps.AttackerDebuff, sender) ?? 0n,
+                debuffDamageReduction: round.debuffDamageReduction,
+                debuffMaxStack: round.debuffMaxStack,
+                breachLimit: round.breachLimit,
+                maxHp: Initializers.maxHp,
+                currentHp: getCurrentHitpoints(testbed)!,
+            };
+
+            let start = performance.now();
+            sendAttack(testbed, sender, amount, attached);
+            const actual = input.currentHp - getCurrentHitpoints(testbed)!;
+            report.contractMs += performance.now() - start;
+
+            start = performance.now();
+            const expected = computeDamage(input).effectiveDamage;
+            report.modelMs += performance.now() - start;
+            const preview = previewDamage(input, attached.map(t => t.asset));
+
+            report.cases++;
+            if (actual !== expected || preview !== actual) {
+                report.mismatches.push({seed, input, expected, actual, preview});
+            }
+            if (testbed.getContractMemoryValue("isDefeated") === 1n) break;
+            timeLapse({testbed, blocks: 1n});
+        }
+    }
+    return report;
+}
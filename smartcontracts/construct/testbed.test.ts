@@ -0,0 +1,80 @@
+import {describe, expect, test} from "vitest";
+import {SimulatorTestbed, type TransactionObj} from "signum-smartc-testbed";
+import {Context} from "./context";
+import {
+    attack,
+    BootstrapScenario,
+    bootstrapTestbed,
+    bootstrapTestbedWith,
+    DefaultRequiredInitializers,
+    forkTestbed,
+    getCurrentHitpoints
+} from "./lib";
+
+describe("Testbed Snapshots", () => {
+
+    test('should start every fork from the bootstrapped state', () => {
+        const first = bootstrapTestbed();
+        attack({testbed: first, signa: 100n})
+        expect(getCurrentHitpoints(first)).toBe(DefaultRequiredInitializers.maxHp - 10n)
+
+        const second = bootstrapTestbed();
+        expect(getCurrentHitpoints(second)).toBe(DefaultRequiredInitializers.maxHp)
+        expect(second.getAccount(Context.SenderAccount1)).toBeUndefined()
+    })
+
+    test('should not affect the original when forking a running testbed', () => {
+        const original = bootstrapTestbed();
+        attack({testbed: original, signa: 100n})
+        const transactionCount = original.getTransactions().length;
+
+        const fork = forkTestbed(original);
+        attack({testbed: fork, signa: 100n, sender: Context.SenderAccount2})
+
+        expect(getCurrentHitpoints(fork)).toBe(DefaultRequiredInitializers.maxHp - 20n)
+        expect(getCurrentHitpoints(original)).toBe(DefaultRequiredInitializers.maxHp - 10n)
+        expect(original.getTransactions().length).toBe(transactionCount)
+    })
+
+    test('should match a full replay when bootstrapping with extra steps', () => {
+        const TokenId = 3000n;
+        const steps: TransactionObj[] = [
+            {
+                blockheight: 2,
+                amount: Context.ActivationFee,
+                sender: Context.CreatorAccount,
+                messageArr: [Context.Methods.SetTokenDecimals, TokenId, 2n],
+                recipient: Context.ThisContract,
+            },
+            {
+                blockheight: 2,
+                amount: Context.ActivationFee,
+                sender: Context.CreatorAccount,
+                messageArr: [Context.Methods.SetBreachLimit, 30n],
+                recipient: Context.ThisContract,
+            },
+            {
+                blockheight: 4,
+                amount: Context.ActivationFee,
+                sender: Context.CreatorAccount,
+                messageArr: [Context.Methods.SetDamageAddition, TokenId, 50n, 100n],
+                recipient: Context.ThisContract,
+            },
+        ];
+
+        const replayed = new SimulatorTestbed([...BootstrapScenario, ...steps])
+            .loadContract(Context.ContractPath, DefaultRequiredInitializers)
+            .runScenario();
+        const forked = bootstrapTestbedWith(steps);
+
+        for (const name of ['breachLimit', 'isActive', 'hpTokenId']) {
+            expect(forked.getContractMemoryValue(name)).toBe(replayed.getContractMemoryValue(name))
+        }
+        expect(forked.getContractMapValue(Context.Maps.TokenDecimalsInfo, TokenId)).toBe(replayed.getContractMapValue(Context.Maps.TokenDecimalsInfo, TokenId))
+        expect(forked.getContractMapValue(Context.Maps.DamageAddition, TokenId)).toBe(replayed.getContractMapValue(Context.Maps.DamageAddition, TokenId))
+        expect(forked.getContract().balance).toBe(replayed.getContract().balance)
+        expect(forked.getTransactions().length).toBe(replayed.getTransactions().length)
+        expect(getCurrentHitpoints(forked)).toBe(getCurrentHitpoints(replayed))
+    })
+
+})